@@ -1,18 +1,28 @@
 // #include <codeanalysis/Generator.hpp>
 #include <codeanalysis/parser/utils/SyntaxKind.hpp>
 #include <codeanalysis/lexer/Lexer.hpp>
+#include <codeanalysis/lexer/SourceText.hpp>
 #include <codeanalysis/parser/Parser.hpp>
 #include <codeanalysis/binder/Binder.hpp>
 #include <codeanalysis/binder/utils/BoundProgram.hpp>
 #include <codeanalysis/evaluator/Evaluator.hpp>
 #include <codeanalysis/parser/utils/ExpressionSyntax.hpp>
 #include <codeanalysis/printer/BoundNodePrinter.hpp>
+#include <codeanalysis/vm/BytecodeCompiler.hpp>
+#include <codeanalysis/vm/VM.hpp>
+#include <codeanalysis/closure/ClosureCompiler.hpp>
+#include <codeanalysis/utils/StringTable.hpp>
+#include <codeanalysis/output/Output.hpp>
+#include <codeanalysis/utils/FileTable.hpp>
+#include <codeanalysis/utils/Allocations.hpp>
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <fstream>
 #include <memory>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 #include <boost/program_options.hpp>
 
@@ -22,7 +32,16 @@ int main(int argc, char* argv[])
     boost::program_options::options_description desc("Allowed options");
     desc.add_options()
         ("help", "produce help message")
-        ("input,i", boost::program_options::value<std::string>()->required(), "input file");
+        ("input,i", boost::program_options::value<std::string>()->required(), "input file")
+        ("engine", boost::program_options::value<std::string>()->default_value("tree"), "execution engine: tree | vm | closure")
+        ("max-call-depth", boost::program_options::value<std::size_t>()->default_value(100000), "maximum number of nested calls before a stack overflow is reported")
+        ("intern-input", "intern the strings returned by input(), so comparing them with other interned strings is a pointer compare")
+        ("flush", boost::program_options::value<std::string>(), "when printed lines are written out: line | full | exit {line on a terminal, full otherwise}")
+        ("async-output", "write the output from a background thread")
+        ("stats", "print the number of heap allocations and of strings allocated by the run on stderr")
+        ("lex-bench", boost::program_options::value<int>(), "only tokenize the input this many times with each lexer scanner the CPU supports and print the MB/s on stderr")
+        ("lex-threads", boost::program_options::value<unsigned>()->default_value(1), "threads tokenizing an input of several MB {0: one per core}")
+        ("intern-limit", boost::program_options::value<std::size_t>()->default_value(65536), "size of the string table above which input() results are no longer interned");
 
     boost::program_options::variables_map vm;
     try {
@@ -35,27 +54,44 @@ int main(int argc, char* argv[])
             return EXIT_SUCCESS;
         }
 
+        trylang::Allocations::_counting = vm.count("stats") > 0;
+
         /* Retrieve the filename */
         std::string filename = vm["input"].as<std::string>();
-        // std::cout << "Input file: " << filename << std::endl;
+        std::string engine = vm["engine"].as<std::string>();
+        std::size_t maxCallDepth = vm["max-call-depth"].as<std::size_t>();
+
+        auto flush = vm.count("flush") ? trylang::Output::ParsePolicy(vm["flush"].as<std::string>()) : trylang::Output::DefaultPolicy();
+        trylang::Output::Instance().Configure(flush, vm.count("async-output") > 0);
 
-        /* Handling the file */
-        std::ifstream infile(filename);
-        if(!infile.is_open())
+        auto& stringTable = trylang::StringTable::Instance();
+        stringTable._internInput = vm.count("intern-input") > 0;
+        stringTable._inputLimit = vm["intern-limit"].as<std::size_t>();
+        if(engine != "tree" && engine != "vm" && engine != "closure")
         {
-            throw std::runtime_error("Not able to open file");
+            throw std::runtime_error("Unknown engine '" + engine + "'");
         }
+        // std::cout << "Input file: " << filename << std::endl;
 
-        std::stringstream buffer;
-        buffer << infile.rdbuf();
+        /* The tokens view the source, it lives until the end of the run */
+        auto lexThreads = vm["lex-threads"].as<unsigned>();
+        if(lexThreads == 0)
+        {
+            lexThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
 
-        auto tokens = trylang::Lexer::Tokenizer(std::move(buffer.str()));
-        if(tokens.size() == 0)
+        auto source = trylang::SourceText::Load(filename);
+        if(vm.count("lex-bench"))
         {
-            throw std::runtime_error("No Tokens Present");
+            trylang::Lexer::Benchmark(source->_text, vm["lex-bench"].as<int>(), lexThreads, std::cerr);
+            trylang::Output::Instance().Close();
+            return EXIT_SUCCESS;
         }
 
-        auto compilationUnitSyntax = trylang::Parser::AST(std::move(tokens));
+        /* A single thread lexes while the Parser pulls, several lex the whole text up front */
+        auto compilationUnitSyntax = lexThreads > 1
+            ? trylang::Parser::AST(trylang::Lexer::Tokenizer(source->_text, lexThreads))
+            : trylang::Parser::AST(source->_text);
         if(!compilationUnitSyntax)
         {
             throw std::runtime_error("Error at Parser");
@@ -78,13 +114,38 @@ int main(int argc, char* argv[])
         // std::cout << ":::::::::::::::::::::::::::::::::::::::::::::::FUNCTIONS:::::::::::::::::::::::::::::::::::::::::::\n";
         // trylang::NodePrinter::WriteFunctions(program->_functionsInfoAndBody);
 
-        trylang::Evaluator evaluator(std::move(program));
-        trylang::object_t result = evaluator.Evaluate();
-        if(result.has_value())
+        trylang::Value result;
+        if(engine == "vm")
+        {
+            trylang::VM machine(trylang::BytecodeCompiler::Compile(program.get()), maxCallDepth);
+            result = machine.Run();
+        }
+        else if(engine == "closure")
+        {
+            result = trylang::ClosureCompiler::Compile(program.get(), maxCallDepth)->Run();
+        }
+        else
+        {
+            trylang::Evaluator evaluator(std::move(program), maxCallDepth);
+            result = evaluator.Evaluate();
+        }
+
+        trylang::FileTable::Instance().CloseAll();
+
+        auto& output = trylang::Output::Instance();
+        if(result.HasValue())
+        {
+            output.WriteValue(result);
+        }
+        output.EndLine();
+        output.Close();
+
+        if(vm.count("stats"))
         {
-            std::visit(trylang::PrintVisitor{}, *result);
+            std::cerr << "heap allocations: " << trylang::Allocations::_count.load() << " {" << trylang::Allocations::_bytes.load() << " bytes}\n";
+            std::cerr << "strings allocated: " << trylang::StringObject::_allocations
+                      << " {" << trylang::StringObject::_allocatedCharacters << " characters}\n";
         }
-        std::cout << "\n";
 
     } catch (const boost::program_options::error& e) {
 
@@ -95,6 +156,9 @@ int main(int argc, char* argv[])
 
     } catch(const std::exception& e)
     {
+        /* Whatever the program printed or wrote before failing comes first */
+        trylang::FileTable::Instance().CloseAll();
+        trylang::Output::Instance().Close();
         std::cerr << e.what() << '\n';
         return EXIT_FAILURE;
     }
@@ -5,11 +5,12 @@
 #include <optional>
 #include <codeanalysis/parser/utils/SyntaxKind.hpp>
 #include <codeanalysis/utils/Symbol.hpp>
+#include <codeanalysis/utils/Value.hpp>
 #include <stack>
 
 namespace trylang
 {
-    struct SyntaxToken;
+    struct TokenStream;
     struct ExpressionSyntax;
     struct StatementSyntax;
     struct TypeClauseSyntax;
@@ -36,12 +37,18 @@ namespace trylang
     struct CompilationUnitSyntax;
     struct BoundScope;
     struct BoundProgram;
+    struct ConstantPool;
 
     struct Binder
     {
         std::shared_ptr<BoundScope> _scope = nullptr;
         FunctionSymbol* _function = nullptr;
         int _labelCountForBreakAndContinueStatement = 0;
+        int _localCount = 0;    /* Next free frame slot of _function */
+        int _frameSize = 0;     /* Highest number of frame slots alive at the same time */
+        int _globalCount = 0;   /* Next free global index, only used by the top level Binder */
+        ConstantPool* _constants = nullptr; /* Shared by every Binder of the program */
+        const TokenStream* _tokens = nullptr; /* Text and kind of the tokens the syntax nodes refer to */
         static std::stringstream _buffer;
         std::stack<std::pair<LabelSymbol, LabelSymbol>> _loopStack; /* One for BreakLabel and other for ContinueLabel */
 
@@ -74,9 +81,12 @@ namespace trylang
         std::unique_ptr<BoundExpressionNode> BindNameExpression(NameExpressionSyntax* syntax);
         std::unique_ptr<BoundExpressionNode> BindAssignmentExpression(AssignmentExpressionSyntax* syntax);
         std::unique_ptr<BoundExpressionNode> BindLiteralExpression(LiteralExpressionSyntax* syntax);
+        std::unique_ptr<BoundExpressionNode> BindLiteral(const Value& value);
         std::unique_ptr<BoundExpressionNode> BindUnaryExpression(UnaryExpressionSyntax* syntax);
         std::unique_ptr<BoundExpressionNode> BindBinaryExpression(BinaryExpressionSyntax* syntax);
+        std::unique_ptr<BoundExpressionNode> BindConcatExpression(std::unique_ptr<BoundExpressionNode> left, std::unique_ptr<BoundExpressionNode> right);
         std::unique_ptr<BoundExpressionNode> BindCallExpression(CallExpressionSyntax *syntax);
+        std::unique_ptr<BoundExpressionNode> BindFormatExpression(CallExpressionSyntax *syntax);
         std::unique_ptr<BoundStatementNode> BindWhileStatement(BoundWhileStatement *syntax);
     };
 }
\ No newline at end of file
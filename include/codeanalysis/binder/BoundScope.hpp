@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <codeanalysis/utils/Symbol.hpp>
 #include <unordered_map>
 #include <vector>
@@ -12,8 +13,9 @@ namespace trylang
     struct BoundScope
     {
         std::shared_ptr<BoundScope> _parent;
-        std::unordered_map<std::string, std::shared_ptr<VariableSymbol>> _variables;
-        std::unordered_map<std::string, std::shared_ptr<FunctionSymbol>> _functions;
+        /* Keys view the _name of their own symbol, so names straight from the tokens are looked up without a copy */
+        std::unordered_map<std::string_view, std::shared_ptr<VariableSymbol>> _variables;
+        std::unordered_map<std::string_view, std::shared_ptr<FunctionSymbol>> _functions;
 
         explicit BoundScope(const std::shared_ptr<BoundScope>& parent)
          : _parent(parent)
@@ -32,7 +34,7 @@ namespace trylang
             return true;
         }
 
-        std::shared_ptr<FunctionSymbol> TryLookUpFunction(const std::string& name)
+        std::shared_ptr<FunctionSymbol> TryLookUpFunction(std::string_view name)
         {
             auto it = _functions.find(name);
             if(it != _functions.end())
@@ -61,7 +63,7 @@ namespace trylang
             return true;
         }
 
-        std::shared_ptr<VariableSymbol> TryLookUpVariable(const std::string& name)
+        std::shared_ptr<VariableSymbol> TryLookUpVariable(std::string_view name)
         {
             auto it = _variables.find(name);
             if(it != _variables.end())
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <vector>
+#include <functional>
 #include <codeanalysis/binder/utils/BoundNodeKind.hpp>
+#include <codeanalysis/binder/utils/ConstantPool.hpp>
 #include <codeanalysis/utils/Types.hpp>
+#include <codeanalysis/utils/Value.hpp>
 #include <memory>
 #include <optional>
 #include <string>
@@ -54,12 +57,64 @@ namespace trylang
 
         static BoundBinaryOperator* Bind(SyntaxKind syntaxKind, const char* leftOperandType, const char* rightOperandType);
 
+        /* Applies the operator on already evaluated operands. Their types were checked by the Binder when it picked this operator */
+        virtual Value Evaluate(const Value& left, const Value& right) const = 0;
+
         /*****************************************************************************************************************************************************/
         BoundNodeKind Kind() override;
         std::vector<BoundNode*> GetChildren() override;
         /*****************************************************************************************************************************************************/
 
     };
+
+    /* One specialization per entry of _boundBinaryOperatorArray, so evaluating a binary expression is a single virtual call */
+    template<typename Operand, typename Operation>
+    struct BoundTypedBinaryOperator : public BoundBinaryOperator
+    {
+        using BoundBinaryOperator::BoundBinaryOperator;
+
+        Value Evaluate(const Value& left, const Value& right) const override
+        {
+            return Operation{}(left.template As<Operand>(), right.template As<Operand>());
+        }
+    };
+
+    using BoundAddIntOperator = BoundTypedBinaryOperator<int, std::plus<int>>;
+    using BoundSubtractIntOperator = BoundTypedBinaryOperator<int, std::minus<int>>;
+    using BoundMultiplyIntOperator = BoundTypedBinaryOperator<int, std::multiplies<int>>;
+    using BoundDivideIntOperator = BoundTypedBinaryOperator<int, std::divides<int>>;
+    using BoundEqualsIntOperator = BoundTypedBinaryOperator<int, std::equal_to<int>>;
+    using BoundNotEqualsIntOperator = BoundTypedBinaryOperator<int, std::not_equal_to<int>>;
+    using BoundLessIntOperator = BoundTypedBinaryOperator<int, std::less<int>>;
+    using BoundLessEqualsIntOperator = BoundTypedBinaryOperator<int, std::less_equal<int>>;
+    using BoundGreaterIntOperator = BoundTypedBinaryOperator<int, std::greater<int>>;
+    using BoundGreaterEqualsIntOperator = BoundTypedBinaryOperator<int, std::greater_equal<int>>;
+    using BoundAndBoolOperator = BoundTypedBinaryOperator<bool, std::logical_and<bool>>;
+    using BoundOrBoolOperator = BoundTypedBinaryOperator<bool, std::logical_or<bool>>;
+    using BoundEqualsBoolOperator = BoundTypedBinaryOperator<bool, std::equal_to<bool>>;
+    using BoundNotEqualsBoolOperator = BoundTypedBinaryOperator<bool, std::not_equal_to<bool>>;
+    using BoundAddStringOperator = BoundTypedBinaryOperator<std::string, std::plus<std::string>>;
+
+    /* String equality goes through Value::StringEquals, which compares interned strings by pointer */
+    struct BoundEqualsStringOperator : public BoundBinaryOperator
+    {
+        using BoundBinaryOperator::BoundBinaryOperator;
+
+        Value Evaluate(const Value& left, const Value& right) const override
+        {
+            return Value::StringEquals(left, right);
+        }
+    };
+
+    struct BoundNotEqualsStringOperator : public BoundBinaryOperator
+    {
+        using BoundBinaryOperator::BoundBinaryOperator;
+
+        Value Evaluate(const Value& left, const Value& right) const override
+        {
+            return !Value::StringEquals(left, right);
+        }
+    };
     
     struct BoundExpressionNode : public BoundNode
     {
@@ -103,6 +158,7 @@ namespace trylang
     struct BoundGotoStatement : public BoundStatementNode
     {
         LabelSymbol _label;
+        int _target = -1; /* Index of the statement following _label, resolved by Lower::Link */
 
         explicit BoundGotoStatement(LabelSymbol label);
 
@@ -115,6 +171,7 @@ namespace trylang
         LabelSymbol _label;
         std::unique_ptr<BoundExpressionNode> _condition;
         bool _jumpIfFalse;
+        int _target = -1; /* Index of the statement following _label, resolved by Lower::Link */
 
         BoundConditionalGotoStatement(LabelSymbol label, std::unique_ptr<BoundExpressionNode> condition, bool jumpIfFalse);
 
@@ -136,6 +193,7 @@ namespace trylang
     struct BoundReturnStatement : public BoundStatementNode
     {
         std::unique_ptr<BoundExpressionNode> _expression;
+        bool _isTailCall = false; /* Set by Lower when _expression is a call of a user defined function */
 
         explicit BoundReturnStatement(std::unique_ptr<BoundExpressionNode> expression);
 
@@ -238,6 +296,7 @@ namespace trylang
 
         std::shared_ptr<FunctionSymbol> _function;
         std::vector<std::unique_ptr<BoundExpressionNode>> _arguments;
+        bool _streamed = false; /* print(a + b + ...) writing each part straight to the output, set by Lower::HoistTopExpression */
 
         BoundCallExpression(const std::shared_ptr<FunctionSymbol>& function, std::vector<std::unique_ptr<BoundExpressionNode>> arguments);
 
@@ -271,9 +330,10 @@ namespace trylang
 
     struct BoundLiteralExpression : public BoundExpressionNode
     {
-        object_t _value;
+        const Value& _value; /* Entry of the ConstantPool of the program */
+        int _constant;       /* Index of that entry */
 
-        explicit BoundLiteralExpression(const object_t& value);
+        BoundLiteralExpression(const ConstantPool& constants, int constant);
         
         const char* Type() override;
         BoundNodeKind Kind() override;
@@ -305,6 +365,51 @@ namespace trylang
         std::vector<BoundNode*> GetChildren() override;
     };
 
+    /* Created by Lower for && and || used as a value. _right is evaluated only when _left does not decide the result */
+    struct BoundShortCircuitExpression : public BoundExpressionNode
+    {
+        std::unique_ptr<BoundExpressionNode> _left;
+        BoundBinaryOperator* _op; /* LogicalAnd or LogicalOr */
+        std::unique_ptr<BoundExpressionNode> _right;
+
+        BoundShortCircuitExpression(std::unique_ptr<BoundExpressionNode> left, BoundBinaryOperator* op, std::unique_ptr<BoundExpressionNode> right);
+
+        const char* Type() override;
+        BoundNodeKind Kind() override;
+        std::vector<BoundNode*> GetChildren() override;
+    };
+
+    /*
+     *  Created by the Binder for a chain of string additions {a + b + string(n)}. Conversions to string are left out of the
+     *  parts, every part is formatted like string(part) straight into the single allocation of the result
+     * */
+    struct BoundConcatExpression : public BoundExpressionNode
+    {
+        std::vector<std::unique_ptr<BoundExpressionNode>> _parts;
+
+        explicit BoundConcatExpression(std::vector<std::unique_ptr<BoundExpressionNode>> parts);
+
+        const char* Type() override;
+        BoundNodeKind Kind() override;
+        std::vector<BoundNode*> GetChildren() override;
+    };
+
+    /*
+     *  Created by Lower for "x = x + a + b" on a string variable. The parts are appended to the buffer of x, in place while
+     *  nothing else shares it. The parts never read or assign x
+     * */
+    struct BoundAppendExpression : public BoundExpressionNode
+    {
+        std::shared_ptr<VariableSymbol> _variable;
+        std::vector<std::unique_ptr<BoundExpressionNode>> _parts;
+
+        BoundAppendExpression(const std::shared_ptr<VariableSymbol>& variable, std::vector<std::unique_ptr<BoundExpressionNode>> parts);
+
+        const char* Type() override;
+        BoundNodeKind Kind() override;
+        std::vector<BoundNode*> GetChildren() override;
+    };
+
     void PrettyPrintBoundNodes(BoundNode* node, std::string indent = "");
     void PrettyPrintBoundNodesForFunctionBodies(const std::unordered_map<std::string, std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>>& functionBodies, std::string indent = "");
 
@@ -23,6 +23,9 @@ namespace trylang
         ErrorExpression,
         CallExpression,
         ConversionExpression,
+        ShortCircuitExpression,
+        AppendExpression,
+        ConcatExpression,
 
         BlockStatement,
         ExpressionStatement,
@@ -67,6 +70,9 @@ namespace trylang
         {BoundNodeKind::ErrorExpression, "ErrorExpression"},
         {BoundNodeKind::CallExpression, "CallExpression"},
         {BoundNodeKind::ConversionExpression, "ConversionExpression"},
+        {BoundNodeKind::ShortCircuitExpression, "ShortCircuitExpression"},
+        {BoundNodeKind::AppendExpression, "AppendExpression"},
+        {BoundNodeKind::ConcatExpression, "ConcatExpression"},
 
         {BoundNodeKind::BlockStatement, "BlockStatement"},
         {BoundNodeKind::ExpressionStatement, "ExpressionStatement"},
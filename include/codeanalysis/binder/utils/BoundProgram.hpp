@@ -3,22 +3,28 @@
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <codeanalysis/utils/Symbol.hpp>
 #include <codeanalysis/binder/utils/BoundExpressionNode.hpp>
+#include <codeanalysis/binder/utils/ConstantPool.hpp>
 
 namespace trylang
 {
     struct BoundProgram
     {
+        std::unique_ptr<ConstantPool> _constants; /* Declared first so that it outlives the literals referring to it */
         std::unordered_map<std::string, std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>> _functionsInfoAndBody;
-        std::unordered_map<std::string, std::shared_ptr<VariableSymbol>> _variables;
+        std::unordered_map<std::string_view, std::shared_ptr<VariableSymbol>> _variables; /* Global scope, see BoundScope */
         std::unique_ptr<BoundBlockStatement> _statement;
+        int _globalCount = 0; /* Every GlobalVariableSymbol::_index is below it, including the ones declared in nested blocks */
 
         BoundProgram(
-                    std::unordered_map<std::string, std::shared_ptr<VariableSymbol>>&& variables,
+                    std::unordered_map<std::string_view, std::shared_ptr<VariableSymbol>>&& variables,
                     std::unordered_map<std::string, std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>> functionsInfoAndBody,
-                    std::unique_ptr<BoundBlockStatement> statement
-                ) : _functionsInfoAndBody(std::move(functionsInfoAndBody)), _variables(std::move(variables)), _statement(std::move(statement))
+                    std::unique_ptr<BoundBlockStatement> statement,
+                    int globalCount,
+                    std::unique_ptr<ConstantPool> constants
+                ) : _constants(std::move(constants)), _functionsInfoAndBody(std::move(functionsInfoAndBody)), _variables(std::move(variables)), _statement(std::move(statement)), _globalCount(globalCount)
         {
         }
         
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <codeanalysis/utils/Value.hpp>
+#include <deque>
+#include <string_view>
+#include <unordered_map>
+
+namespace trylang
+{
+    /*
+     *  Literals of a program, built by the Binder. Equal literals share one entry, so a script repeating the same literal
+     *  holds a single Value for it. Every BoundLiteralExpression refers to its entry, evaluating it never allocates
+     * */
+    struct ConstantPool
+    {
+        std::deque<Value> _values; /* std::deque never moves its elements, literals keep a reference to theirs */
+        std::unordered_map<int, int> _ints;
+        int _bools[2] = {-1, -1};
+        std::unordered_map<std::string_view, int> _strings; /* Keys view the text of their pooled Value */
+
+        /* Returns the index of the entry equal to value, adding it first if needed */
+        int Add(const Value& value);
+    };
+}
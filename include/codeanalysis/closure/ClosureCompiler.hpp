@@ -0,0 +1,103 @@
+#pragma once
+
+#include <codeanalysis/utils/Value.hpp>
+#include <codeanalysis/utils/Symbol.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace trylang
+{
+    struct BoundStatementNode;
+    struct BoundBlockStatement;
+    struct BoundExpressionNode;
+    struct BoundVariableDeclaration;
+    struct BoundConditionalGotoStatement;
+    struct BoundReturnStatement;
+    struct BoundLiteralExpression;
+    struct BoundVariableExpression;
+    struct BoundAssignmentExpression;
+    struct BoundUnaryExpression;
+    struct BoundBinaryExpression;
+    struct BoundShortCircuitExpression;
+    struct BoundAppendExpression;
+    struct BoundConcatExpression;
+    struct BoundCallExpression;
+    struct BoundConversionExpression;
+
+    struct BoundProgram;
+
+    /*
+     *  Every closure is built once from a bound node and captures everything it needs {children, slots, operand types}.
+     *  A statement closure returns the index of the next statement to execute, or -1 after a return
+     * */
+    using ExpressionClosure = std::function<Value()>;
+    using StatementClosure = std::function<int()>;
+
+    struct ClosureFunction
+    {
+        int _frameSize = 0;
+        std::vector<StatementClosure> _body;
+    };
+
+    /* State shared by all the closures of a ClosureProgram */
+    struct ClosureRuntime
+    {
+        std::vector<Value> _globals;
+        std::deque<std::vector<Value>> _frames; /* Frame pool, _frames[i] is reused by every call made at depth i */
+        std::size_t _frameDepth = 0;
+        std::size_t _maxCallDepth = 0;
+        std::uintptr_t _stackLimit = 0; /* Closures call each other on the C++ stack, a call below this address fails */
+        Value* _frame = nullptr;
+        Value _lastValue;
+        const ClosureFunction* _tailCallee = nullptr; /* Set by a tail return, Execute continues with its body */
+        std::vector<Value> _scratch; /* Parts of the concatenations being evaluated, nested ones stack above */
+
+        Value Execute(const ClosureFunction& function);
+    };
+
+    struct ClosureProgram
+    {
+        ClosureRuntime _runtime;
+        ClosureFunction _main;
+        std::unordered_map<FunctionSymbol*, ClosureFunction> _functions;
+
+        /* Runs on a thread of its own, its stack is sized for _maxCallDepth nested calls */
+        Value Run();
+    };
+
+    /* Compiles the lowered BoundProgram {output of Lower::RewriteAndFlatten} into closures */
+    struct ClosureCompiler
+    {
+        ClosureProgram* _program = nullptr;
+        ClosureRuntime* _runtime = nullptr;
+
+        static std::unique_ptr<ClosureProgram> Compile(BoundProgram* program, std::size_t maxCallDepth);
+
+        void CompileFunction(ClosureFunction& function, BoundBlockStatement* body);
+
+        StatementClosure CompileStatement(BoundStatementNode* node, int next);
+        StatementClosure CompileVariableDeclaration(BoundVariableDeclaration* node, int next);
+        StatementClosure CompileConditionalGotoStatement(BoundConditionalGotoStatement* node, int next);
+        StatementClosure CompileReturnStatement(BoundReturnStatement* node);
+        StatementClosure CompileTailCall(BoundCallExpression* node);
+
+        ExpressionClosure CompileExpression(BoundExpressionNode* node);
+        ExpressionClosure CompileLiteralExpression(BoundLiteralExpression* node);
+        ExpressionClosure CompileVariableExpression(BoundVariableExpression* node);
+        ExpressionClosure CompileAssignmentExpression(BoundAssignmentExpression* node);
+        ExpressionClosure CompileUnaryExpression(BoundUnaryExpression* node);
+        ExpressionClosure CompileBinaryExpression(BoundBinaryExpression* node);
+        ExpressionClosure CompileShortCircuitExpression(BoundShortCircuitExpression* node);
+        ExpressionClosure CompileAppendExpression(BoundAppendExpression* node);
+        ExpressionClosure CompileConcatExpression(BoundConcatExpression* node);
+        ExpressionClosure CompileCallExpression(BoundCallExpression* node);
+        std::vector<ExpressionClosure> CompileArguments(BoundCallExpression* node);
+        const ClosureFunction* FindFunction(FunctionSymbol* function);
+        ExpressionClosure CompileConversionExpression(BoundConversionExpression* node);
+    };
+}
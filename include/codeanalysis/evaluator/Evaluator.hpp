@@ -2,10 +2,12 @@
 
 #include <codeanalysis/binder/utils/BoundExpressionNode.hpp>
 #include <memory>
-#include <codeanalysis/utils/Types.hpp>
+#include <codeanalysis/utils/Value.hpp>
 #include <unordered_map>
 #include <codeanalysis/utils/Symbol.hpp>
-#include <stack>
+#include <cstddef>
+#include <deque>
+#include <vector>
 
 namespace trylang
 {
@@ -28,31 +30,63 @@ namespace trylang
     struct BoundCallExpression;
     struct BoundConversionExpression;
     struct BoundBinaryExpression;
+    struct BoundShortCircuitExpression;
+    struct BoundAppendExpression;
+    struct BoundConcatExpression;
 
-    struct Environment;
+    using StatementList = std::vector<std::unique_ptr<BoundStatementNode>>;
+
+    /* Statement of the caller which made a call, execution resumes there once the callee returns */
+    struct ReturnPoint
+    {
+        const StatementList* _statements;
+        std::size_t _index;
+    };
 
     struct Evaluator
     {
-        std::stack<variable_map_t> _locals; /* For Recursive function calls */
-        std::shared_ptr<Environment> _env = nullptr;
+        std::deque<std::vector<Value>> _frames; /* Frame pool, _frames[i] is reused by every call made at depth i */
+        std::size_t _frameDepth = 0;
+        std::size_t _maxCallDepth;
+        Value* _frame = nullptr; /* Parameter and local slots of the function being executed */
+        std::vector<Value> _globals; /* Indexed by GlobalVariableSymbol::_index */
+        std::vector<ReturnPoint> _returnPoints; /* One per active call, trylang calls never use the C++ stack */
+        std::vector<Value> _scratch; /* Parts of the concatenations being evaluated, nested ones stack above */
 
         std::unique_ptr<BoundProgram> _program;
 
-        object_t _lastValue;
-
-        Evaluator(std::unique_ptr<BoundProgram> program);
-
-        object_t Evaluate();
-        object_t EvaluateStatement(BoundBlockStatement* body);
-
-        object_t EvaluateExpression(BoundExpressionNode* node);
-        object_t EvaluateLiteralExpression(BoundLiteralExpression* node);
-        object_t EvaluateVariableExpression(BoundVariableExpression *node);
-        object_t EvaluateAssignmentExpression(BoundAssignmentExpression* node);
-        object_t EvaluateUnaryExpression(BoundUnaryExpression* node);
-        object_t EvaluateCallExpression(BoundCallExpression* node);
-        object_t EvaluateConversionExpression(BoundConversionExpression* node);
-        object_t EvaluateBinaryExpression(BoundBinaryExpression* node);
+        Value _lastValue;
+
+        Evaluator(std::unique_ptr<BoundProgram> program, std::size_t maxCallDepth);
+
+        Value Evaluate();
+        Value EvaluateStatement(BoundBlockStatement* body);
+
+        static bool IsUserCall(BoundExpressionNode* node);
+        std::vector<Value>& ClaimFrame(FunctionSymbol* function);
+        void EnterCall(BoundCallExpression* node, const StatementList*& statements, std::size_t& index);
+        void ReturnFromCall(const StatementList*& statements, std::size_t& index);
+        void AssignVariable(VariableSymbol* variable, const Value& value);
+        Value& VariableSlot(VariableSymbol* variable);
+
+        /* Reads literals and variables in place instead of copying their Value, other operands are evaluated into storage */
+        const Value& EvaluateOperand(BoundExpressionNode* node, Value& storage);
+        static bool IsPureOperand(BoundExpressionNode* node);
+
+        Value EvaluateExpression(BoundExpressionNode* node);
+        Value EvaluateLiteralExpression(BoundLiteralExpression* node);
+        Value EvaluateVariableExpression(BoundVariableExpression *node);
+        Value EvaluateAssignmentExpression(BoundAssignmentExpression* node);
+        Value EvaluateUnaryExpression(BoundUnaryExpression* node);
+        Value EvaluateCallExpression(BoundCallExpression* node);
+        Value EvaluateConversionExpression(BoundConversionExpression* node);
+        Value EvaluateBinaryExpression(BoundBinaryExpression* node);
+        Value EvaluateShortCircuitExpression(BoundShortCircuitExpression* node);
+        Value EvaluateAppendExpression(BoundAppendExpression* node);
+        Value EvaluateConcatExpression(BoundConcatExpression* node);
+
+        /* Reuses the current frame for "return f(...)" and returns f, whose body the caller continues with */
+        FunctionSymbol* EvaluateTailCall(BoundCallExpression* node);
 
 
         // void EvaluateStatement(BoundStatementNode* node);
@@ -100,11 +100,11 @@ namespace trylang
         static void GenerateProgram(BoundProgram* program, const char* IRfilePath);
         Generator(BoundProgram* program);
         void GenerateMain(BoundBlockStatement* rootBlock);
-        void GenerateFunction(const std::unordered_map<std::string, std::shared_ptr<VariableSymbol>>& variables, const std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>& functionInfoAndBody);
+        void GenerateFunction(const std::unordered_map<std::string_view, std::shared_ptr<VariableSymbol>>& variables, const std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>& functionInfoAndBody);
 
         void ModuleInitialization();
         void SetupExternalFunctions();
-        void SetupGlobalEnv(const std::unordered_map<std::string, std::shared_ptr<VariableSymbol>>& variables);
+        void SetupGlobalEnv(const std::unordered_map<std::string_view, std::shared_ptr<VariableSymbol>>& variables);
 
         llvm::GlobalVariable* CreateGlobalVar(const std::string& name, llvm::Constant* initialize);
 
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace trylang
+{
+    /*
+     *  Source of the lines returned by input() and readLine(). _fd is mapped whole when it is a regular file, otherwise
+     *  it is read in BLOCK_SIZE blocks, and lines are cut out of that memory instead of going through std::getline
+     * */
+    struct Input
+    {
+        static constexpr std::size_t BLOCK_SIZE = 1 << 20;
+
+        int _fd;
+        const char* _cursor = nullptr; /* Start of the next line */
+        const char* _end = nullptr;    /* End of the bytes available in _block or _mapping */
+        std::vector<char> _block;
+        void* _mapping = nullptr;
+        std::size_t _mappingSize = 0;
+        bool _opened = false;
+        bool _exhausted = false;       /* Nothing left to read from _fd, only [_cursor, _end) remains */
+        bool _interactive = false;     /* _fd is a terminal, pending output is flushed before waiting on it */
+
+        explicit Input(int fd);
+        Input(const Input&) = delete;
+        Input& operator=(const Input&) = delete;
+        ~Input();
+
+        /* Lines of stdin */
+        static Input& Instance();
+
+        /* lines(): true while a line is left for input() */
+        bool HasLine();
+
+        /* input(): the next line without its '\n', an empty line once _fd is exhausted. The view is valid until the next call */
+        std::string_view NextLine();
+
+        void Open();
+        bool Refill(); /* Reads one more block, false once _fd is exhausted */
+    };
+}
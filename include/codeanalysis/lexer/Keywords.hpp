@@ -0,0 +1,74 @@
+#pragma once
+
+#include <codeanalysis/parser/utils/SyntaxKind.hpp>
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+namespace trylang
+{
+    /*
+     *  Keyword table built at compile time. KeywordHash is a perfect hash of the keywords below: every one of them
+     *  gets its own slot, so a lookup is one hash and one compare. The static_assert fails when a new keyword collides
+     * */
+    struct Keyword
+    {
+        std::string_view _text;
+        SyntaxKind _kind = SyntaxKind::IdentifierToken;
+    };
+
+    constexpr std::array<Keyword, 11> KEYWORDS = {{
+        {"true", SyntaxKind::TrueKeyword},
+        {"false", SyntaxKind::FalseKeyword},
+        {"var", SyntaxKind::VarKeyword},
+        {"let", SyntaxKind::LetKeyword},
+        {"if", SyntaxKind::IfKeyword},
+        {"else", SyntaxKind::ElseKeyword},
+        {"while", SyntaxKind::WhileKeyword},
+        {"function", SyntaxKind::FunctionKeyword},
+        {"break", SyntaxKind::BreakKeyword},
+        {"continue", SyntaxKind::ContinueKeyword},
+        {"return", SyntaxKind::ReturnKeyword},
+    }};
+
+    constexpr std::size_t KEYWORD_SLOTS = 32;
+
+    /* text is not empty */
+    constexpr std::size_t KeywordHash(std::string_view text)
+    {
+        return (static_cast<unsigned char>(text.front()) + static_cast<unsigned char>(text.back()) + (text.size() << 3)) & (KEYWORD_SLOTS - 1);
+    }
+
+    constexpr std::array<Keyword, KEYWORD_SLOTS> BuildKeywordSlots()
+    {
+        std::array<Keyword, KEYWORD_SLOTS> slots{};
+        for(const auto& keyword: KEYWORDS)
+        {
+            slots[KeywordHash(keyword._text)] = keyword;
+        }
+        return slots;
+    }
+
+    constexpr std::array<Keyword, KEYWORD_SLOTS> KEYWORD_TABLE = BuildKeywordSlots();
+
+    constexpr bool KeywordHashIsPerfect()
+    {
+        for(const auto& keyword: KEYWORDS)
+        {
+            if(KEYWORD_TABLE[KeywordHash(keyword._text)]._text != keyword._text)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static_assert(KeywordHashIsPerfect(), "Two keywords share a slot, change KeywordHash");
+
+    /* SyntaxKind::IdentifierToken when text is not a keyword */
+    constexpr SyntaxKind KeywordKind(std::string_view text)
+    {
+        const auto& slot = KEYWORD_TABLE[KeywordHash(text)];
+        return slot._text == text ? slot._kind : SyntaxKind::IdentifierToken;
+    }
+}
@@ -1,20 +1,20 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <memory>
 #include <sstream>
 #include <codeanalysis/parser/utils/SyntaxKind.hpp>
 #include <codeanalysis/utils/Types.hpp>
+#include <codeanalysis/lexer/TokenStream.hpp>
+#include <codeanalysis/lexer/Scanner.hpp>
 #include <vector>
 
 namespace trylang
 {
-    struct SyntaxToken;
-        
-
-    struct Lexer
+    struct Lexer : TokenSource
     {
-        std::string _text;
+        std::string_view _text;         /* Viewed by the tokens, see SourceText */
         std::size_t _text_size;
         int _line;
         int _start;                     /* points to the first character in the lexeme being scanned */
@@ -22,25 +22,18 @@ namespace trylang
         static std::stringstream _buffer;      /* stores the errors */
 
 
-        std::vector<std::unique_ptr<SyntaxToken>> _tokens; /* It will be moved from Tokenize() */
-
-        std::unordered_map<std::string, SyntaxKind> _keywords = {
-            {"true", SyntaxKind::TrueKeyword},
-            {"false", SyntaxKind::FalseKeyword},
-            {"var", SyntaxKind::VarKeyword},
-            {"let", SyntaxKind::LetKeyword},
-            {"if", SyntaxKind::IfKeyword},
-            {"else", SyntaxKind::ElseKeyword},
-            {"while", SyntaxKind::WhileKeyword},
-            {"function", SyntaxKind::FunctionKeyword},
-            {"break", SyntaxKind::BreakKeyword},
-            {"continue", SyntaxKind::ContinueKeyword},
-            {"return", SyntaxKind::ReturnKeyword},
-        };
+        TokenStream _tokens; /* It will be moved from Tokenize() */
+        std::ostream* _errors;          /* _buffer, or the errors of one chunk when tokenizing in parallel */
+        Token* _next = nullptr;         /* Set by Fill() to where AddToken() writes the token being pulled */
+        const Scanner& _scanner;        /* Skips whitespace, comments, identifiers, digits and string bodies */
 
         static std::string Errors();
-        explicit Lexer(std::string text);
-        std::vector<std::unique_ptr<SyntaxToken>> Tokenize();
+        explicit Lexer(std::string_view text, const Scanner& scanner = Scanner::Instance());
+        /* Only tokenizes [first, last) of text, which starts at line */
+        Lexer(std::string_view text, std::size_t first, std::size_t last, int line, std::ostream& errors, const Scanner& scanner = Scanner::Instance());
+        TokenStream Tokenize();
+        void ScanTokens();
+        int Fill(Token* tokens, int count) override;    /* Lexes only as far as the tokens asked for */
         void ScanToken();
 
         char Current();
@@ -49,6 +42,9 @@ namespace trylang
         char Advance();
         bool IsAtEnd();
         bool Match(char expected);
+        const char* At(int index);
+        const char* End();
+        void MoveTo(const char* position);
 
         void AddToken(SyntaxKind kind);
         void AddToken(SyntaxKind kind, object_t&& value);
@@ -58,7 +54,17 @@ namespace trylang
         void ReadNumberLiteral();
         void GenerateError(std::string message);
 
-        static std::vector<std::unique_ptr<SyntaxToken>> Tokenizer(std::string&& text);
+        static TokenStream Tokenizer(std::string_view text, unsigned threads = 1);
+        static void PrintErrors();
+
+        /*
+         *  Same tokens and errors as Tokenize(). A large text is cut after newlines which are outside of string literals,
+         *  the chunks are tokenized on up to threads threads and joined back in order
+         * */
+        static TokenStream TokenizeParallel(std::string_view text, unsigned threads);
+
+        /* Tokenizes text rounds times with each Scanner this CPU supports, then on 2, 4 .. threads threads, and writes the throughput in MB/s */
+        static void Benchmark(std::string_view text, int rounds, unsigned threads, std::ostream& out);
 
     };
 }
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string_view>
+
+namespace trylang
+{
+    inline bool IsDigit(char ch)
+    {
+        return ch >= '0' && ch <= '9';
+    }
+
+    /* std::isalnum of the "C" locale, without its undefined behaviour for negative chars */
+    inline bool IsAlphaNumeric(char ch)
+    {
+        auto lower = static_cast<char>(ch | 0x20);
+        return IsDigit(ch) || (lower >= 'a' && lower <= 'z');
+    }
+
+    /*
+     *  Runs of characters the Lexer consumes in one step. Each function returns the first character of [first, last)
+     *  which is not part of the run. The SSE2 and AVX2 versions classify 16 or 32 characters per compare, the last
+     *  characters of the text go through the scalar loop so nothing past last is ever read
+     * */
+    struct Scanner
+    {
+        const char* _name;
+        const char* (*_whitespace)(const char* first, const char* last, int& newlines);     /* ' ', '\t', '\r', '\n' */
+        const char* (*_until)(const char* first, const char* last, char stop, int& newlines); /* Anything but stop */
+        const char* (*_identifier)(const char* first, const char* last);                   /* IsAlphaNumeric */
+        const char* (*_digits)(const char* first, const char* last);
+
+        /* The fastest one this CPU runs, chosen on first use */
+        static const Scanner& Instance();
+
+        /* "scalar", "sse2" or "avx2". nullptr when it is not built in or the CPU lacks it */
+        static const Scanner* Find(std::string_view name);
+    };
+}
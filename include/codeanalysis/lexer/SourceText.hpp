@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+
+namespace trylang
+{
+    /*
+     *  Text of the program being compiled. A regular file is mapped whole, anything else {a pipe, /dev/stdin} is read
+     *  into _copy. Tokens view this memory, so it has to outlive the syntax tree
+     * */
+    struct SourceText
+    {
+        std::string_view _text;
+        void* _mapping = nullptr;
+        std::size_t _mappingSize = 0;
+        std::string _copy;
+
+        SourceText() = default;
+        SourceText(const SourceText&) = delete;
+        SourceText& operator=(const SourceText&) = delete;
+        ~SourceText();
+
+        static std::unique_ptr<SourceText> Load(const std::string& path);
+    };
+}
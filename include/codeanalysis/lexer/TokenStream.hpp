@@ -0,0 +1,104 @@
+#pragma once
+
+#include <codeanalysis/parser/utils/SyntaxKind.hpp>
+#include <codeanalysis/utils/Types.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace trylang
+{
+    /* One token on its own, the way a TokenSource hands it out */
+    struct Token
+    {
+        SyntaxKind _kind = SyntaxKind::EndOfFileToken;
+        int _line = 0;
+        std::uint32_t _offset = 0;
+        std::uint32_t _length = 0;
+        object_t _value;
+    };
+
+    /* Where the Parser pulls its tokens from */
+    struct TokenSource
+    {
+        virtual ~TokenSource() = default;
+
+        /* Writes the next tokens, up to count of them, and returns how many. Past the end of the text they are EndOfFileTokens */
+        virtual int Fill(Token* tokens, int count) = 0;
+    };
+
+    /*
+     *  Output of the Lexer, one entry per token spread over parallel arrays: a token is its index. The text of a token
+     *  is a range of the SourceText, only number and string literals have a value
+     * */
+    struct TokenStream
+    {
+        std::string_view _source;
+        std::vector<SyntaxKind> _kinds;
+        std::vector<int> _lines;
+        std::vector<std::uint32_t> _offsets;
+        std::vector<std::uint32_t> _lengths;
+        std::vector<int> _literals;     /* Index in _values, -1 for a token without a value */
+        std::vector<object_t> _values;  /* The Parser moves each of them into its LiteralExpressionSyntax */
+
+        void Add(SyntaxKind kind, int line, std::size_t offset, std::size_t length)
+        {
+            _kinds.push_back(kind);
+            _lines.push_back(line);
+            _offsets.push_back(static_cast<std::uint32_t>(offset));
+            _lengths.push_back(static_cast<std::uint32_t>(length));
+            _literals.push_back(-1);
+        }
+
+        void Add(SyntaxKind kind, int line, std::size_t offset, std::size_t length, object_t&& value)
+        {
+            this->Add(kind, line, offset, length);
+            _literals.back() = static_cast<int>(_values.size());
+            _values.emplace_back(std::move(value));
+        }
+
+        /* Without its value */
+        void Add(const Token& token)
+        {
+            this->Add(token._kind, token._line, token._offset, token._length);
+        }
+
+        /* The value of the token is moved out */
+        Token Take(int token)
+        {
+            Token taken{_kinds[token], _lines[token], _offsets[token], _lengths[token], {}};
+            if(_literals[token] != -1)
+            {
+                taken._value = std::move(this->Value(token));
+            }
+            return taken;
+        }
+
+        std::size_t Size() const
+        {
+            return _kinds.size();
+        }
+
+        SyntaxKind Kind(int token) const
+        {
+            return _kinds[token];
+        }
+
+        int Line(int token) const
+        {
+            return _lines[token];
+        }
+
+        std::string_view Text(int token) const
+        {
+            return _source.substr(_offsets[token], _lengths[token]);
+        }
+
+        /* Only for a token with a value */
+        object_t& Value(int token)
+        {
+            return _values[_literals[token]];
+        }
+    };
+}
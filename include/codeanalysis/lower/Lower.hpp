@@ -2,19 +2,42 @@
 
 #include <codeanalysis/utils/Symbol.hpp>
 #include <memory>
+#include <vector>
 
 namespace trylang
 {   
     struct BoundStatementNode;
     struct BoundBlockStatement;
     struct BoundExpressionNode;
+    struct BoundCallExpression;
 
     struct Lower
     {
         int _labelCountForIfStatement = 0;
 
+        /* Temporaries are globals for the top level program and frame slots for a function, numbered from _variableCount */
+        FunctionSymbol* _function = nullptr;
+        int _variableCount = 0;
+        int _temporaryCount = 0; /* Temporaries used by the statement being hoisted, reset for every statement */
+        int _temporaryLimit = 0;
+
         LabelSymbol GenerateLabel();
+        std::shared_ptr<VariableSymbol> GenerateTemporary(const char* type);
         std::unique_ptr<BoundBlockStatement> Flatten(std::unique_ptr<BoundStatementNode> statement);
+        static void Link(BoundBlockStatement* body);
+
+        /*
+         *  Moves every call of a user defined function into its own statement {var temporary = f(...)}, so a call is only
+         *  ever the whole expression of a variable declaration, an expression statement or a tail return. The Evaluator
+         *  relies on it to run calls without recursing
+         * */
+        void HoistCalls(BoundBlockStatement* body);
+        std::unique_ptr<BoundExpressionNode> HoistTopExpression(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements);
+        std::unique_ptr<BoundExpressionNode> HoistExpression(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements);
+        void HoistArguments(BoundCallExpression* node, std::vector<std::unique_ptr<BoundStatementNode>>& statements);
+        void HoistOperands(std::vector<std::unique_ptr<BoundExpressionNode>*> operands, std::vector<std::unique_ptr<BoundStatementNode>>& statements);
+        std::unique_ptr<BoundExpressionNode> HoistShortCircuitExpression(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements);
+        std::unique_ptr<BoundExpressionNode> Spill(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements);
 
         std::unique_ptr<BoundStatementNode> RewriteStatement(std::unique_ptr<BoundStatementNode> node);
 
@@ -37,11 +60,14 @@ namespace trylang
         std::unique_ptr<BoundExpressionNode> RewriteLiteralExpression(std::unique_ptr<BoundExpressionNode> node);
         std::unique_ptr<BoundExpressionNode> RewriteVariableExpression(std::unique_ptr<BoundExpressionNode> node);
         std::unique_ptr<BoundExpressionNode> RewriteAssignmentExpression(std::unique_ptr<BoundExpressionNode> node);
+        std::unique_ptr<BoundExpressionNode> RewriteSelfAppend(std::unique_ptr<BoundExpressionNode> node);
+        std::unique_ptr<BoundExpressionNode> RewriteConcatExpression(std::unique_ptr<BoundExpressionNode> node);
         std::unique_ptr<BoundExpressionNode> RewriteCallExpression(std::unique_ptr<BoundExpressionNode> node);
         std::unique_ptr<BoundExpressionNode> RewriteConversionExpression(std::unique_ptr<BoundExpressionNode> node);
         std::unique_ptr<BoundExpressionNode> RewriteUnaryExpression(std::unique_ptr<BoundExpressionNode> node);
         std::unique_ptr<BoundExpressionNode> RewriteBinaryExpression(std::unique_ptr<BoundExpressionNode> node);
 
-        static std::unique_ptr<BoundBlockStatement> RewriteAndFlatten(std::unique_ptr<BoundStatementNode> statement);
+        /* variableCount is the number of globals {function == nullptr} or the frame size, it grows by the temporaries */
+        static std::unique_ptr<BoundBlockStatement> RewriteAndFlatten(std::unique_ptr<BoundStatementNode> statement, FunctionSymbol* function, int& variableCount);
     };   
 }
\ No newline at end of file
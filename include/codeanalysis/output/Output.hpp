@@ -0,0 +1,81 @@
+#pragma once
+
+#include <codeanalysis/utils/Value.hpp>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace trylang
+{
+    enum class FlushPolicy
+    {
+        Line,   /* Written out after every line */
+        Full,   /* Written out whenever Output::BUFFER_SIZE bytes are pending */
+        Exit    /* Kept in memory until the program ends or fails */
+    };
+
+    /* Single producer, single consumer byte queue. Positions only grow, the index in _data is position & (size - 1) */
+    struct RingBuffer
+    {
+        std::vector<char> _data;
+        std::atomic<std::size_t> _head{0}; /* Bytes pushed so far, only written by the producer */
+        std::atomic<std::size_t> _tail{0}; /* Bytes popped so far, only written by the consumer */
+
+        explicit RingBuffer(std::size_t capacity); /* capacity is a power of two */
+
+        /* Copies as much of data as fits and returns how much it copied */
+        std::size_t Push(const char* data, std::size_t size);
+    };
+
+    /*
+     *  Destination of everything a trylang program prints, and of every file it writes {see FileTable}. Lines are
+     *  gathered in _buffer and handed out according to _policy, either straight to _fd or to a background writer
+     *  thread through _ring. There is a single producer, so the output order is the order of the calls whichever way is used
+     * */
+    struct Output
+    {
+        static constexpr std::size_t BUFFER_SIZE = 1 << 16;
+        static constexpr std::size_t RING_SIZE = 1 << 20;
+
+        int _fd;
+        FlushPolicy _policy = FlushPolicy::Line;
+        std::string _buffer;
+        std::unique_ptr<RingBuffer> _ring; /* Only set while the writer thread runs */
+        std::thread _writer;
+        std::atomic<bool> _closing{false};
+        int _error = 0; /* errno of the first failed write */
+
+        explicit Output(int fd);
+        Output(const Output&) = delete;
+        Output& operator=(const Output&) = delete;
+        ~Output();
+
+        /* Output of print(), on stdout */
+        static Output& Instance();
+
+        /* Line when stdout is a terminal, Full otherwise */
+        static FlushPolicy DefaultPolicy();
+        static FlushPolicy ParsePolicy(const std::string& name);
+
+        void Configure(FlushPolicy policy, bool background);
+
+        void Write(std::string_view text);
+        void WriteLine(std::string_view text);
+        /* Writes string(value) without building it, returns its length */
+        std::size_t WriteValue(const Value& value);
+        void EndLine();
+
+        /* Hands the pending bytes over to stdout or to the writer thread */
+        void Flush();
+
+        /* Flushes and waits until everything reached _fd. Called on exit and before an error is reported */
+        void Close();
+
+        void RunWriter();
+        void WriteOut(const char* data, std::size_t size);
+    };
+}
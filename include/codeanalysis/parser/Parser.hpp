@@ -1,13 +1,15 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <memory>
+#include <string_view>
 #include <sstream>
 #include <codeanalysis/parser/utils/SyntaxKind.hpp>
+#include <codeanalysis/lexer/TokenStream.hpp>
 
 namespace trylang
 {
-    struct SyntaxToken;
     struct TypeClauseSyntax;
     struct ExpressionSyntax;
     struct CompilationUnitSyntax;
@@ -16,21 +18,30 @@ namespace trylang
 
     struct Parser
     {
-        int _current = 0;
+        static constexpr int LOOKAHEAD = 256; /* Tokens pulled from _source at once, Peek(offset) needs offset < LOOKAHEAD */
+
         std::vector<std::unique_ptr<StatementSyntax>> _statements;
-        std::vector<std::unique_ptr<SyntaxToken>> _tokens;
-        std::size_t _tokens_size;
+        TokenSource& _source;
+        std::array<Token, LOOKAHEAD> _lookahead;   /* _count tokens pulled from _source and not consumed yet, from _head */
+        int _head = 0;
+        int _count = 0;
+        TokenStream _tokens;    /* Only the tokens the syntax nodes refer to, it is moved into the CompilationUnitSyntax */
         static std::stringstream _buffer;
 
-        SyntaxToken* Peek(int offset);
-        SyntaxToken* Current();
+        Token& Peek(int offset);
+        void Pull(int offset);
+        Token& Current();
+        SyntaxKind PeekKind(int offset);
+        SyntaxKind CurrentKind();
         bool IsAtEnd();
-        std::unique_ptr<SyntaxToken> Advance();
-        std::unique_ptr<SyntaxToken> Consume(SyntaxKind kind, std::string message);
+        int Advance();
+        void Skip();
+        int Consume(SyntaxKind kind, std::string message);
+        void Expect(SyntaxKind kind, std::string message);
         bool Check(SyntaxKind kind);
         void SynchronizeAfterAnExpectionForInvalidTokenMatch();
         void GenerateError(int line, std::string message);
-        void Error(SyntaxToken* token, std::string message);
+        void Error(const Token& token, std::string message);
 
         std::unique_ptr<StatementSyntax> ParseFunctionDeclarationStatement();
         std::vector<std::unique_ptr<ParameterSyntax>> ParseParameterList();
@@ -66,8 +77,12 @@ namespace trylang
         // int GetUnaryOperatorPrecedance(SyntaxKind kind);
 
         static std::string Errors();
-        explicit Parser(std::vector<std::unique_ptr<SyntaxToken>>&& tokens);
-        static std::unique_ptr<CompilationUnitSyntax> AST(std::vector<std::unique_ptr<SyntaxToken>>&& tokens);
+        Parser(TokenSource& source, std::string_view text);
+        /* Pulls the tokens from a Lexer while parsing */
+        static std::unique_ptr<CompilationUnitSyntax> AST(std::string_view text);
+        /* Parses the tokens of a whole text lexed beforehand */
+        static std::unique_ptr<CompilationUnitSyntax> AST(TokenStream&& tokens);
+        static std::unique_ptr<CompilationUnitSyntax> Report(std::unique_ptr<CompilationUnitSyntax> compilationSyntax);
 
         std::unique_ptr<CompilationUnitSyntax> Parse();
     };
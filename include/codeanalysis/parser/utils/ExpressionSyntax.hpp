@@ -1,11 +1,12 @@
 #pragma once
 
-#include <codeanalysis/lexer/Lexer.hpp>
+#include <codeanalysis/lexer/TokenStream.hpp>
 #include <vector>
 #include <codeanalysis/parser/utils/SyntaxKind.hpp>
 #include <codeanalysis/utils/Types.hpp>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <iostream>
 
 namespace trylang
@@ -19,29 +20,6 @@ namespace trylang
 
     void PrettyPrintSyntaxNodes(SyntaxNode* node, std::string indent = "");
 
-    struct SyntaxToken : SyntaxNode
-    {
-        SyntaxKind _kind;
-        int _line;
-        std::string _text;
-        object_t _value;
-
-        SyntaxToken(SyntaxKind kind, int line, std::string&& text, object_t&& value);
-
-        SyntaxToken(const SyntaxToken&) = delete;
-        SyntaxToken& operator=(const SyntaxToken&) = delete;
-
-        SyntaxToken(SyntaxToken&&) = default;
-        SyntaxToken& operator=(SyntaxToken&&) = default;
-
-        /**********************************************************************************************/
-        SyntaxKind Kind() override;
-        std::vector<SyntaxNode*> GetChildren() override;
-        /**********************************************************************************************/
-
-        friend std::ostream& operator<<(std::ostream& out, const SyntaxToken& token);
-    };
-
     /* Abstract Class */
     struct ExpressionSyntax : public SyntaxNode
     {
@@ -56,20 +34,20 @@ namespace trylang
 
     struct TypeClauseSyntax : public SyntaxNode
     {
-        std::unique_ptr<SyntaxToken> _colonToken;
-        std::unique_ptr<SyntaxToken> _identifierToken;
+        int _colonToken;
+        int _identifierToken;
 
-        TypeClauseSyntax(std::unique_ptr<SyntaxToken> colonToken, std::unique_ptr<SyntaxToken> identifierToken);
+        TypeClauseSyntax(int colonToken, int identifierToken);
         SyntaxKind Kind() override;
         std::vector<SyntaxNode*> GetChildren() override;
     };
 
     struct ParameterSyntax : public SyntaxNode
     {
-        std::unique_ptr<SyntaxToken> _identifier;
+        int _identifier;
         std::unique_ptr<TypeClauseSyntax> _type;
 
-        ParameterSyntax(std::unique_ptr<SyntaxToken> identifier, std::unique_ptr<TypeClauseSyntax> type);
+        ParameterSyntax(int identifier, std::unique_ptr<TypeClauseSyntax> type);
         SyntaxKind Kind() override;
         std::vector<SyntaxNode*> GetChildren() override;
 
@@ -77,20 +55,20 @@ namespace trylang
 
     struct FunctionDeclarationStatementSyntax : public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _functionKeyword;
-        std::unique_ptr<SyntaxToken> _identifier;
-        std::unique_ptr<SyntaxToken> _openParenthesisToken;
+        int _functionKeyword;
+        int _identifier;
+        int _openParenthesisToken;
         std::vector<std::unique_ptr<ParameterSyntax>> _parameters;
-        std::unique_ptr<SyntaxToken> _closeParenthesisToken;
+        int _closeParenthesisToken;
         std::unique_ptr<TypeClauseSyntax> _typeClause;
         std::unique_ptr<StatementSyntax> _body;
 
         FunctionDeclarationStatementSyntax(
-                std::unique_ptr<SyntaxToken> functionKeyword,
-                std::unique_ptr<SyntaxToken> identifier,
-                std::unique_ptr<SyntaxToken> openParenthesisToken,
+                int functionKeyword,
+                int identifier,
+                int openParenthesisToken,
                 std::vector<std::unique_ptr<ParameterSyntax>> parameters,
-                std::unique_ptr<SyntaxToken> closeParenthesisToken,
+                int closeParenthesisToken,
                 std::unique_ptr<TypeClauseSyntax> typeClause,
                 std::unique_ptr<StatementSyntax> body
         );
@@ -101,18 +79,18 @@ namespace trylang
 
     struct VariableDeclarationStatementSyntax : public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _keyword;
-        std::unique_ptr<SyntaxToken> _identifier; /* identifierToken */
+        int _keyword;
+        int _identifier; /* identifierToken */
         std::unique_ptr<TypeClauseSyntax> _typeClause = nullptr;
-        std::unique_ptr<SyntaxToken> _equalsToken;
+        int _equalsToken;
         std::unique_ptr<ExpressionSyntax> _expression;
 
 
         VariableDeclarationStatementSyntax(
-                    std::unique_ptr<SyntaxToken> keyword,
-                    std::unique_ptr<SyntaxToken> identifier,
+                    int keyword,
+                    int identifier,
                     std::unique_ptr<TypeClauseSyntax> typeClause,
-                    std::unique_ptr<SyntaxToken> equalsToken,
+                    int equalsToken,
                     std::unique_ptr<ExpressionSyntax> expression
                 );
 
@@ -124,8 +102,9 @@ namespace trylang
     struct CompilationUnitSyntax : public SyntaxNode
     {
         std::vector<std::unique_ptr<StatementSyntax>> _statements; /* This includes both StatementSyntax and FunctionDeclarationStatementSyntax */
+        TokenStream _tokens; /* The int members of the syntax nodes are indices of these tokens */
 
-        CompilationUnitSyntax(std::vector<std::unique_ptr<StatementSyntax>> statements);
+        CompilationUnitSyntax(std::vector<std::unique_ptr<StatementSyntax>> statements, TokenStream tokens);
 
         SyntaxKind Kind() override;
         std::vector<SyntaxNode*> GetChildren() override;
@@ -133,14 +112,14 @@ namespace trylang
 
     struct BlockStatementSyntax: public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _openBraceToken;
+        int _openBraceToken;
         std::vector<std::unique_ptr<StatementSyntax>> _statements;
-        std::unique_ptr<SyntaxToken> _closeBraceToken;
+        int _closeBraceToken;
 
         BlockStatementSyntax(
-                    std::unique_ptr<SyntaxToken> openBraceToken,
+                    int openBraceToken,
                     std::vector<std::unique_ptr<StatementSyntax>> statements ,
-                    std::unique_ptr<SyntaxToken> closeBraceToken);
+                    int closeBraceToken);
 
         SyntaxKind Kind() override;
 
@@ -159,10 +138,10 @@ namespace trylang
 
     struct ElseStatementSyntax: public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _elseKeyword;
+        int _elseKeyword;
         std::unique_ptr<StatementSyntax> _elseStatement;
 
-        ElseStatementSyntax(std::unique_ptr<SyntaxToken> elseKeyword, std::unique_ptr<StatementSyntax> elseStatement);
+        ElseStatementSyntax(int elseKeyword, std::unique_ptr<StatementSyntax> elseStatement);
 
         SyntaxKind Kind() override;
 
@@ -172,13 +151,13 @@ namespace trylang
 
     struct IfStatementSyntax : public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _ifKeyword;
+        int _ifKeyword;
         std::unique_ptr<ExpressionSyntax> _condition;
         std::unique_ptr<StatementSyntax> _thenStatement;
         std::unique_ptr<StatementSyntax> _elseClause = nullptr;
 
         IfStatementSyntax(
-                std::unique_ptr<SyntaxToken> ifKeyword,
+                int ifKeyword,
                 std::unique_ptr<ExpressionSyntax> condition,
                 std::unique_ptr<StatementSyntax> thenStatement,
                 std::unique_ptr<StatementSyntax> elseClause
@@ -191,12 +170,12 @@ namespace trylang
 
     struct WhileStatementSyntax : public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _whileKeyword;
+        int _whileKeyword;
         std::unique_ptr<ExpressionSyntax> _condition;
         std::unique_ptr<StatementSyntax> _body;
 
         WhileStatementSyntax(
-                std::unique_ptr<SyntaxToken> whileKeyword,
+                int whileKeyword,
                 std::unique_ptr<ExpressionSyntax> condition,
                 std::unique_ptr<StatementSyntax> body
         );
@@ -208,9 +187,9 @@ namespace trylang
 
     struct BreakStatementSyntax : public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _breakKeyword;
+        int _breakKeyword;
 
-        explicit BreakStatementSyntax(std::unique_ptr<SyntaxToken> breakKeyword);
+        explicit BreakStatementSyntax(int breakKeyword);
 
         SyntaxKind Kind() override;
 
@@ -219,9 +198,9 @@ namespace trylang
 
     struct ContinueStatementSyntax : public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _continueKeyword;
+        int _continueKeyword;
 
-        explicit ContinueStatementSyntax(std::unique_ptr<SyntaxToken> continueKeyword);
+        explicit ContinueStatementSyntax(int continueKeyword);
 
         SyntaxKind Kind() override;
 
@@ -230,10 +209,10 @@ namespace trylang
 
     struct ReturnStatementSyntax : public StatementSyntax
     {
-        std::unique_ptr<SyntaxToken> _returnKeyword;
+        int _returnKeyword;
         std::unique_ptr<ExpressionSyntax> _expression = nullptr;
 
-        ReturnStatementSyntax(std::unique_ptr<SyntaxToken> returnKeyword, std::unique_ptr<ExpressionSyntax> expression);
+        ReturnStatementSyntax(int returnKeyword, std::unique_ptr<ExpressionSyntax> expression);
 
         SyntaxKind Kind() override;
 
@@ -242,15 +221,15 @@ namespace trylang
 
     struct CallExpressionSyntax: public ExpressionSyntax
     {
-        std::unique_ptr<SyntaxToken> _identifier; /* name of the function during calling function */
-        std::unique_ptr<SyntaxToken> _openParenthesis;
-        std::unique_ptr<SyntaxToken> _closeParenthesis;
+        int _identifier; /* name of the function during calling function */
+        int _openParenthesis;
+        int _closeParenthesis;
         std::vector<std::unique_ptr<ExpressionSyntax>> _arguments;
 
-        CallExpressionSyntax(std::unique_ptr<SyntaxToken> identifier,
-                             std::unique_ptr<SyntaxToken> openParenthesis,
+        CallExpressionSyntax(int identifier,
+                             int openParenthesis,
                              std::vector<std::unique_ptr<ExpressionSyntax>> arguments,
-                             std::unique_ptr<SyntaxToken> closeParenthesis);
+                             int closeParenthesis);
 
         SyntaxKind Kind() override;
 
@@ -259,9 +238,9 @@ namespace trylang
 
     struct NameExpressionSyntax : public ExpressionSyntax
     {
-        std::unique_ptr<SyntaxToken> _identifierToken;
+        int _identifierToken;
         
-        explicit NameExpressionSyntax(std::unique_ptr<SyntaxToken> identifierToken);
+        explicit NameExpressionSyntax(int identifierToken);
 
         SyntaxKind Kind() override;
 
@@ -271,11 +250,11 @@ namespace trylang
     struct AssignmentExpressionSyntax : public ExpressionSyntax
     {
 
-        std::unique_ptr<SyntaxToken> _identifierToken;
-        std::unique_ptr<SyntaxToken> _equalsToken;
+        int _identifierToken;
+        int _equalsToken;
         std::unique_ptr<ExpressionSyntax> _expression;
 
-        AssignmentExpressionSyntax(std::unique_ptr<SyntaxToken> identifierToken, std::unique_ptr<SyntaxToken> equalsToken, std::unique_ptr<ExpressionSyntax> expression);
+        AssignmentExpressionSyntax(int identifierToken, int equalsToken, std::unique_ptr<ExpressionSyntax> expression);
 
         SyntaxKind Kind() override;
 
@@ -284,11 +263,10 @@ namespace trylang
 
     struct LiteralExpressionSyntax : public ExpressionSyntax
     {
-        std::unique_ptr<SyntaxToken> _literalToken;
+        int _literalToken;
         object_t _value;
         
-        explicit LiteralExpressionSyntax(std::unique_ptr<SyntaxToken> literalToken);
-        LiteralExpressionSyntax(std::unique_ptr<SyntaxToken> literalToken, const object_t& value);
+        LiteralExpressionSyntax(int literalToken, object_t value);
         
         SyntaxKind Kind() override;
 
@@ -298,11 +276,11 @@ namespace trylang
     struct BinaryExpressionSyntax : public ExpressionSyntax
     {
 
-        std::unique_ptr<SyntaxToken> _operatorToken;
+        int _operatorToken;
         std::unique_ptr<ExpressionSyntax> _left;
         std::unique_ptr<ExpressionSyntax> _right;
 
-        BinaryExpressionSyntax(std::unique_ptr<ExpressionSyntax> left, std::unique_ptr<SyntaxToken> operatorToken, std::unique_ptr<ExpressionSyntax> right);
+        BinaryExpressionSyntax(std::unique_ptr<ExpressionSyntax> left, int operatorToken, std::unique_ptr<ExpressionSyntax> right);
 
         SyntaxKind Kind() override;
 
@@ -312,10 +290,10 @@ namespace trylang
     struct UnaryExpressionSyntax : public ExpressionSyntax
     {
 
-        std::unique_ptr<SyntaxToken> _operatorToken;
+        int _operatorToken;
         std::unique_ptr<ExpressionSyntax> _operand;
 
-        UnaryExpressionSyntax(std::unique_ptr<SyntaxToken> operatorToken, std::unique_ptr<ExpressionSyntax> operand);
+        UnaryExpressionSyntax(int operatorToken, std::unique_ptr<ExpressionSyntax> operand);
 
         SyntaxKind Kind() override;
 
@@ -325,11 +303,11 @@ namespace trylang
     struct ParenthesizedExpressionSyntax : public ExpressionSyntax
     {
 
-        std::unique_ptr<SyntaxToken> _openParenthesisToken;
+        int _openParenthesisToken;
         std::unique_ptr<ExpressionSyntax> _expression;
-        std::unique_ptr<SyntaxToken> _closeParenthesisToken;
+        int _closeParenthesisToken;
 
-        ParenthesizedExpressionSyntax(std::unique_ptr<SyntaxToken> openParenthesisToken, std::unique_ptr<ExpressionSyntax> expression, std::unique_ptr<SyntaxToken> closeParenthesisToken);
+        ParenthesizedExpressionSyntax(int openParenthesisToken, std::unique_ptr<ExpressionSyntax> expression, int closeParenthesisToken);
 
         SyntaxKind Kind() override;
 
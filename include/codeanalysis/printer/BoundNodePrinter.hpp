@@ -18,6 +18,9 @@ namespace trylang
     struct BoundErrorExpression;
     struct BoundCallExpression;
     struct BoundConversionExpression;
+    struct BoundShortCircuitExpression;
+    struct BoundAppendExpression;
+    struct BoundConcatExpression;
     struct BoundBlockStatement;
     struct BoundExpressionStatement;
     struct BoundVariableDeclaration; /* BoundVariableDeclarationStatement */
@@ -48,6 +51,9 @@ namespace trylang
         void WriteErrorExpression(BoundErrorExpression* node);
         void WriteCallExpression(BoundCallExpression* node);
         void WriteConversionExpression(BoundConversionExpression* node);
+        void WriteShortCircuitExpression(BoundShortCircuitExpression* node);
+        void WriteAppendExpression(BoundAppendExpression* node);
+        void WriteConcatExpression(BoundConcatExpression* node);
         void WriteBlockStatement(BoundBlockStatement* node);
         void WriteExpressionStatement(BoundExpressionStatement* node);
         void WriteVariableDeclarationStatement(BoundVariableDeclaration* node);
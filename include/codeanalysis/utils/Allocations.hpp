@@ -0,0 +1,18 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace trylang
+{
+    /*
+     *  Every operator new made once _counting is set, counted by the replacement operators of Allocations.cpp. --stats
+     *  sets it before the input is read. Relaxed counters: the lexer and output threads allocate too, only totals matter
+     * */
+    struct Allocations
+    {
+        inline static std::atomic<bool> _counting{false};
+        inline static std::atomic<std::size_t> _count{0};
+        inline static std::atomic<std::size_t> _bytes{0};
+    };
+}
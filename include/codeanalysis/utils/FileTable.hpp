@@ -0,0 +1,38 @@
+#pragma once
+
+#include <codeanalysis/input/Input.hpp>
+#include <codeanalysis/output/Output.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace trylang
+{
+    struct OpenFile
+    {
+        std::string _path;
+        std::unique_ptr<Input> _reader;  /* Set for mode "r" */
+        std::unique_ptr<Output> _writer; /* Set for modes "w" and "a", batches the writes in blocks of Output::BUFFER_SIZE */
+    };
+
+    /* Files opened by the program. The handle given to the program is the file descriptor */
+    struct FileTable
+    {
+        std::unordered_map<int, OpenFile> _files;
+
+        FileTable() = default;
+        FileTable(const FileTable&) = delete;
+        FileTable& operator=(const FileTable&) = delete;
+        ~FileTable();
+
+        static FileTable& Instance();
+
+        int Open(const std::string& path, const std::string& mode);
+        Input& Reader(int handle, const char* builtin);
+        Output& Writer(int handle, const char* builtin);
+        void Close(int handle);
+
+        /* Flushes and closes every file still open. Called on exit and before an error is reported */
+        void CloseAll() noexcept;
+    };
+}
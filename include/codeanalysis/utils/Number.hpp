@@ -0,0 +1,82 @@
+#pragma once
+
+#include <charconv>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace trylang
+{
+    /*
+     *  Conversions between int and text used by the Lexer, int(), string() and Value::WriteText.
+     *  Built on std::from_chars/std::to_chars: errors are part of the result, nothing throws and nothing is allocated
+     *  except by IntToString, which returns its text
+     * */
+    constexpr std::size_t MAX_INT_TEXT_LENGTH = 11; /* "-2147483648" */
+
+    struct ParsedInt
+    {
+        int _value = 0;
+        std::errc _error{}; /* std::errc::invalid_argument without digits, std::errc::result_out_of_range when they do not fit an int */
+        const char* _end = nullptr; /* First character after the number */
+
+        bool Ok() const
+        {
+            return _error == std::errc{};
+        }
+    };
+
+    /* An optional '-' followed by decimal digits, starting exactly at first */
+    inline ParsedInt ParseInt(const char* first, const char* last)
+    {
+        ParsedInt parsed;
+        auto result = std::from_chars(first, last, parsed._value);
+        parsed._error = result.ec;
+        parsed._end = result.ptr;
+        return parsed;
+    }
+
+    /* int(text) keeps the std::stoi rules: leading whitespace and one '+' are skipped, trailing characters are ignored. -1 when there is no int to read */
+    inline int StringToInt(std::string_view text)
+    {
+        const char* first = text.data();
+        const char* last = first + text.size();
+
+        while(first != last && (*first == ' ' || (*first >= '\t' && *first <= '\r')))
+        {
+            first++;
+        }
+
+        if(last - first > 1 && *first == '+' && first[1] >= '0' && first[1] <= '9')
+        {
+            first++;
+        }
+
+        auto parsed = ParseInt(first, last);
+        return parsed.Ok() ? parsed._value : -1;
+    }
+
+    inline std::size_t IntTextLength(int number)
+    {
+        std::size_t length = number < 0 ? 2 : 1;
+        for(auto rest = number / 10; rest != 0; rest /= 10)
+        {
+            length++;
+        }
+        return length;
+    }
+
+    /* Writes number at first, which has room for IntTextLength(number) characters. Returns the end of the text */
+    inline char* WriteInt(int number, char* first, char* last)
+    {
+        return std::to_chars(first, last, number).ptr;
+    }
+
+    inline std::string IntToString(int number)
+    {
+        char buffer[MAX_INT_TEXT_LENGTH];
+        auto* end = WriteInt(number, buffer, buffer + MAX_INT_TEXT_LENGTH);
+        return std::string(buffer, end);
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <codeanalysis/utils/Value.hpp>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace trylang
+{
+    /*
+     *  Table of interned strings shared by the whole process. An interned StringObject is the only one holding its text,
+     *  so two interned Values are equal exactly when they point to the same object {see Value::StringEquals}.
+     *  The table owns one reference of every entry, which also keeps Value::Append from modifying an interned text in place
+     * */
+    struct StringTable
+    {
+        std::unordered_map<std::string_view, StringObject*> _entries; /* Keys view the _text of their own entry */
+        bool _internInput = false;
+        std::size_t _inputLimit = 65536;
+        std::size_t _sweepDelay = 0; /* input() calls left before a full table is swept again */
+
+        StringTable() = default;
+        StringTable(const StringTable&) = delete;
+        StringTable& operator=(const StringTable&) = delete;
+        ~StringTable();
+
+        static StringTable& Instance();
+
+        /* Literals are always interned, they are bounded by the size of the program */
+        Value Intern(const Value& value);
+
+        /* Result of input(). Interned only with --intern-input and while the table holds less than _inputLimit entries */
+        Value InternInput(std::string text);
+
+        /* Drops the entries no Value refers to anymore. Returns the number of dropped entries */
+        std::size_t Sweep();
+    };
+}
@@ -2,6 +2,7 @@
 
 #include <codeanalysis/utils/Types.hpp>
 #include <string>
+#include <string_view>
 #include <typeinfo>
 #include <memory>
 #include <unordered_map>
@@ -19,6 +20,11 @@ namespace trylang
     };
 
     struct FunctionDeclarationStatementSyntax;
+    struct BoundBlockStatement;
+    struct Value;
+
+    /* Implementation of a builtin, arguments points to its evaluated arguments */
+    using NativeFunction = Value (*)(const Value* arguments);
 
     struct Symbol
     {
@@ -54,7 +60,7 @@ namespace trylang
         inline std::unique_ptr<TypeSymbol> ERROR = std::make_unique<TypeSymbol>("?");
     }
 
-    TypeSymbol* LookUpType(const std::string& name);
+    TypeSymbol* LookUpType(std::string_view name);
 
     /* Abstract Type */
     struct VariableSymbol : Symbol
@@ -68,19 +74,23 @@ namespace trylang
 
     struct LocalVariableSymbol : VariableSymbol
     {
-        LocalVariableSymbol(std::string name, bool isReadOnly, const char* type): VariableSymbol(std::move(name), isReadOnly, type){}
+        int _slot = -1; /* Index inside the frame of the function, assigned by the Binder when the variable is declared */
+
+        LocalVariableSymbol(std::string name, bool isReadOnly, const char* type, int slot = -1): VariableSymbol(std::move(name), isReadOnly, type), _slot(slot){}
         SymbolKind Kind() override;
     };
 
     struct GlobalVariableSymbol : VariableSymbol
     {
-        GlobalVariableSymbol(std::string name, bool isReadOnly, const char* type): VariableSymbol(std::move(name), isReadOnly, type){}
+        int _index = -1; /* Index inside the global table of the program, assigned by the Binder when the variable is declared */
+
+        GlobalVariableSymbol(std::string name, bool isReadOnly, const char* type, int index = -1): VariableSymbol(std::move(name), isReadOnly, type), _index(index){}
         SymbolKind Kind() override;
     };
 
     struct ParameterSymbol : LocalVariableSymbol
     {
-        ParameterSymbol(std::string name, bool isReadOnly, const char* type): LocalVariableSymbol(std::move(name), isReadOnly, type){}
+        ParameterSymbol(std::string name, bool isReadOnly, const char* type, int slot = -1): LocalVariableSymbol(std::move(name), isReadOnly, type, slot){}
         SymbolKind Kind() override;
     };
 
@@ -89,26 +99,52 @@ namespace trylang
         const char* _type = nullptr; /* Return type of function */
         std::vector<ParameterSymbol> _parameters;
         FunctionDeclarationStatementSyntax* _declaration = nullptr;
+        BoundBlockStatement* _body = nullptr; /* Lowered body, owned by the BoundProgram */
+        int _frameSize = 0; /* Number of slots needed by the parameters and locals of one call */
+        NativeFunction _native = nullptr; /* Builtins without an engine specific implementation {print, input and lines have one} */
 
         FunctionSymbol(std::string name, std::vector<ParameterSymbol> parameters, const char* type, FunctionDeclarationStatementSyntax* _declaration = nullptr)
             : Symbol(std::move(name)), _type(type), _parameters(std::move(parameters)), _declaration(_declaration)
         {}
 
+        FunctionSymbol(std::string name, std::vector<ParameterSymbol> parameters, const char* type, NativeFunction native)
+            : Symbol(std::move(name)), _type(type), _parameters(std::move(parameters)), _native(native)
+        {}
+
         bool operator==(const FunctionSymbol& other) const;
         SymbolKind Kind() override;
     };
 
     namespace BUILT_IN_FUNCTIONS
     {
+        /* File builtins, defined in FileTable.cpp. A file handle is an int */
+        Value Open(const Value* arguments);
+        Value ReadLine(const Value* arguments);
+        Value HasLine(const Value* arguments);
+        Value Write(const Value* arguments);
+        Value WriteLine(const Value* arguments);
+        Value Close(const Value* arguments);
+
+        /* format(text, ...) takes any number of values, it is bound by Binder::BindFormatExpression instead of being declared */
+        inline const std::string FORMAT = "format";
+
         inline std::unordered_map<std::string, std::shared_ptr<FunctionSymbol>> MAP = {
-                {"print", std::make_shared<FunctionSymbol>("print",std::vector<ParameterSymbol>{ParameterSymbol("text", true,Types::STRING->Name())},Types::INT->Name())},
-                {"input", std::make_shared<FunctionSymbol>("input", std::vector<ParameterSymbol>{}, Types::STRING->Name())}
+                {"print", std::make_shared<FunctionSymbol>("print",std::vector<ParameterSymbol>{ParameterSymbol("text", true,Types::STRING->Name(), 0)},Types::INT->Name())},
+                {"input", std::make_shared<FunctionSymbol>("input", std::vector<ParameterSymbol>{}, Types::STRING->Name())},
+                {"lines", std::make_shared<FunctionSymbol>("lines", std::vector<ParameterSymbol>{}, Types::BOOL->Name())},
+                {"open", std::make_shared<FunctionSymbol>("open", std::vector<ParameterSymbol>{ParameterSymbol("path", true, Types::STRING->Name(), 0), ParameterSymbol("mode", true, Types::STRING->Name(), 1)}, Types::INT->Name(), &Open)},
+                {"readLine", std::make_shared<FunctionSymbol>("readLine", std::vector<ParameterSymbol>{ParameterSymbol("handle", true, Types::INT->Name(), 0)}, Types::STRING->Name(), &ReadLine)},
+                {"hasLine", std::make_shared<FunctionSymbol>("hasLine", std::vector<ParameterSymbol>{ParameterSymbol("handle", true, Types::INT->Name(), 0)}, Types::BOOL->Name(), &HasLine)},
+                {"write", std::make_shared<FunctionSymbol>("write", std::vector<ParameterSymbol>{ParameterSymbol("handle", true, Types::INT->Name(), 0), ParameterSymbol("text", true, Types::STRING->Name(), 1)}, Types::INT->Name(), &Write)},
+                {"writeLine", std::make_shared<FunctionSymbol>("writeLine", std::vector<ParameterSymbol>{ParameterSymbol("handle", true, Types::INT->Name(), 0), ParameterSymbol("text", true, Types::STRING->Name(), 1)}, Types::INT->Name(), &WriteLine)},
+                {"close", std::make_shared<FunctionSymbol>("close", std::vector<ParameterSymbol>{ParameterSymbol("handle", true, Types::INT->Name(), 0)}, Types::INT->Name(), &Close)}
         };
     }
 
     struct LabelSymbol
     {
-        std::string _name{};
+        std::string _name{};    /* Only used for printing */
+        int _id = -1;           /* Unique for every label created, copies share it */
 
         LabelSymbol() = default;
         explicit LabelSymbol(std::string name);
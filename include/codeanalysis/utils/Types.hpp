@@ -1,5 +1,6 @@
 #pragma once
 
+#include <codeanalysis/utils/Number.hpp>
 #include <optional>
 #include <variant>
 #include <unordered_map>
@@ -62,19 +63,7 @@ namespace trylang
 
         int operator()(const std::string& str)
         {
-            int value;
-
-            try
-            {
-                value = std::stoi(str);
-
-            }catch (const std::exception& e)
-            {
-                /*throw std::logic_error("Invalid String value provided for int conversion");*/
-                value = -1;
-            }
-
-            return value;
+            return StringToInt(str);
         }
 
         int operator()(bool boolValue)
@@ -92,7 +81,7 @@ namespace trylang
     {
         std::string operator()(int number)
         {
-            return std::to_string(number);
+            return IntToString(number);
         }
 
         std::string operator()(const std::string& str)
@@ -0,0 +1,267 @@
+#pragma once
+
+#include <codeanalysis/utils/Types.hpp>
+#include <codeanalysis/utils/Number.hpp>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+namespace trylang
+{
+    /* Heap storage of a string Value. The text is only modified in place while a single Value owns it {see Value::Append} */
+    struct StringObject
+    {
+        /* Totals since the start of the process, reported by --stats */
+        inline static std::size_t _allocations = 0;
+        inline static std::size_t _allocatedCharacters = 0;
+
+        int _refCount = 1;
+        bool _interned = false; /* Owned by the StringTable, no other interned object has the same text */
+        std::string _text;
+
+        explicit StringObject(std::string text) : _text(std::move(text))
+        {
+            _allocations++;
+            _allocatedCharacters += _text.size();
+        }
+    };
+
+    /*
+     *  Runtime value used by every execution engine. ints and bools are stored inline and strings are a pointer to a
+     *  refcounted StringObject, so copying a Value never copies characters. object_t stays the representation of the
+     *  lexer and parser {token values}, literals are converted once by the Binder
+     * */
+    struct Value
+    {
+        enum class Tag : unsigned char
+        {
+            None,
+            Int,
+            Bool,
+            String
+        };
+
+        Tag _tag;
+        union
+        {
+            int _int;
+            bool _bool;
+            StringObject* _string;
+        };
+
+        Value() noexcept : _tag(Tag::None), _string(nullptr) {}
+        Value(int number) noexcept : _tag(Tag::Int), _int(number) {}
+        Value(bool boolValue) noexcept : _tag(Tag::Bool), _bool(boolValue) {}
+        Value(std::string text) : _tag(Tag::String), _string(new StringObject(std::move(text))) {}
+        Value(const char* text) : Value(std::string(text)) {}
+
+        Value(const Value& other) noexcept : _tag(other._tag), _string(other._string)
+        {
+            this->Retain();
+        }
+
+        Value(Value&& other) noexcept : _tag(other._tag), _string(other._string)
+        {
+            other._tag = Tag::None;
+        }
+
+        Value& operator=(const Value& other) noexcept
+        {
+            if(this != &other)
+            {
+                other.Retain();
+                this->Release();
+                _tag = other._tag;
+                _string = other._string;
+            }
+            return *this;
+        }
+
+        Value& operator=(Value&& other) noexcept
+        {
+            if(this != &other)
+            {
+                this->Release();
+                _tag = other._tag;
+                _string = other._string;
+                other._tag = Tag::None;
+            }
+            return *this;
+        }
+
+        ~Value()
+        {
+            this->Release();
+        }
+
+        bool HasValue() const { return _tag != Tag::None; }
+        int AsInt() const { return _int; }
+        bool AsBool() const { return _bool; }
+        const std::string& AsString() const { return _string->_text; }
+
+        template<typename T>
+        decltype(auto) As() const
+        {
+            if constexpr (std::is_same_v<T, int>)
+            {
+                return this->AsInt();
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                return this->AsBool();
+            }
+            else
+            {
+                static_assert(std::is_same_v<T, std::string>, "Value only holds int, bool and std::string");
+                return this->AsString();
+            }
+        }
+
+        /* Same contract as std::visit on oobject_t, so PrintVisitor and the conversion visitors work unchanged */
+        template<typename Visitor>
+        decltype(auto) Visit(Visitor&& visitor) const
+        {
+            switch(_tag)
+            {
+                case Tag::Int:
+                    return visitor(_int);
+                case Tag::Bool:
+                    return visitor(_bool);
+                case Tag::String:
+                    return visitor(_string->_text);
+                default:
+                    throw std::logic_error("Value: Visit on an empty value");
+            }
+        }
+
+        /* Shares an existing string, which gains a reference */
+        static Value FromStringObject(StringObject* object) noexcept
+        {
+            Value value;
+            value._tag = Tag::String;
+            value._string = object;
+            object->_refCount++;
+            return value;
+        }
+
+        static Value FromObject(const object_t& object)
+        {
+            if(!object.has_value())
+            {
+                return Value();
+            }
+
+            return std::visit([](const auto& value) { return Value(value); }, *object);
+        }
+
+        /* == on two strings. Interned strings are unique per text, so two different interned objects never hold equal texts */
+        static bool StringEquals(const Value& left, const Value& right)
+        {
+            if(left._string == right._string)
+            {
+                return true;
+            }
+            if(left._string->_interned && right._string->_interned)
+            {
+                return false;
+            }
+            return left._string->_text == right._string->_text;
+        }
+
+        /* Length of string(value), what WriteText writes */
+        std::size_t TextLength() const
+        {
+            switch(_tag)
+            {
+                case Tag::Int:
+                    return IntTextLength(_int);
+                case Tag::Bool:
+                    return _bool ? 4 : 5;
+                case Tag::String:
+                    return _string->_text.size();
+                default:
+                    throw std::logic_error("Value: TextLength on an empty value");
+            }
+        }
+
+        /* Writes string(value) at destination, which has room for TextLength() characters. Returns the end of the text */
+        char* WriteText(char* destination, char* end) const
+        {
+            switch(_tag)
+            {
+                case Tag::Int:
+                    return WriteInt(_int, destination, end);
+                case Tag::Bool:
+                {
+                    const char* text = _bool ? "true" : "false";
+                    auto length = _bool ? 4 : 5;
+                    std::memcpy(destination, text, length);
+                    return destination + length;
+                }
+                case Tag::String:
+                    std::memcpy(destination, _string->_text.data(), _string->_text.size());
+                    return destination + _string->_text.size();
+                default:
+                    throw std::logic_error("Value: WriteText on an empty value");
+            }
+        }
+
+        /* string(parts[0]) + string(parts[1]) + ... built in a single allocation */
+        static Value Concatenate(const Value* parts, std::size_t count)
+        {
+            std::size_t length = 0;
+            for(std::size_t i = 0; i < count; i++)
+            {
+                length += parts[i].TextLength();
+            }
+
+            std::string text(length, '\0');
+            auto* destination = text.data();
+            auto* end = destination + length;
+            for(std::size_t i = 0; i < count; i++)
+            {
+                destination = parts[i].WriteText(destination, end);
+            }
+
+            return Value(std::move(text));
+        }
+
+        /* Appends string(part) in place when this Value is the only owner of the string, otherwise the other owners keep the old text */
+        void Append(const Value& part)
+        {
+            if(_string->_refCount == 1 && !(part._tag == Tag::String && part._string == _string))
+            {
+                auto& text = _string->_text;
+                auto size = text.size();
+                text.resize(size + part.TextLength());
+                part.WriteText(text.data() + size, text.data() + text.size());
+                return;
+            }
+
+            const Value parts[] = {*this, part};
+            *this = Value::Concatenate(parts, 2);
+        }
+
+        void Retain() const noexcept
+        {
+            if(_tag == Tag::String)
+            {
+                _string->_refCount++;
+            }
+        }
+
+        void Release() noexcept
+        {
+            if(_tag == Tag::String && --_string->_refCount == 0)
+            {
+                delete _string;
+            }
+        }
+    };
+
+    static_assert(sizeof(Value) <= 16, "Value is meant to stay two words wide");
+}
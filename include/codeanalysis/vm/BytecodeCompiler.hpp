@@ -0,0 +1,84 @@
+#pragma once
+
+#include <codeanalysis/vm/Chunk.hpp>
+#include <codeanalysis/utils/Symbol.hpp>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace trylang
+{
+    struct BoundNode;
+    struct BoundStatementNode;
+    struct BoundBlockStatement;
+    struct BoundExpressionNode;
+    struct BoundVariableDeclaration;
+    struct BoundConditionalGotoStatement;
+    struct BoundReturnStatement;
+    struct BoundLiteralExpression;
+    struct BoundVariableExpression;
+    struct BoundAssignmentExpression;
+    struct BoundUnaryExpression;
+    struct BoundBinaryExpression;
+    struct BoundShortCircuitExpression;
+    struct BoundAppendExpression;
+    struct BoundConcatExpression;
+    struct BoundCallExpression;
+    struct BoundConversionExpression;
+
+    struct BoundProgram;
+
+    /* Compiles the lowered BoundProgram {output of Lower::RewriteAndFlatten} into register bytecode for the VM */
+    struct BytecodeCompiler
+    {
+        std::unique_ptr<CompiledProgram> _program;
+        std::unordered_map<std::string, int> _functionIndices;
+
+        /* State of the function being compiled */
+        CompiledFunction* _function = nullptr;
+        FunctionSymbol* _functionSymbol = nullptr;
+        int _lastValueRegister = -1;   /* Only used by the top level program to produce the evaluated result */
+        int _firstTemporary = 0;
+        int _nextRegister = 0;
+        std::vector<int> _statementPcs;                     /* First instruction of every statement of the linked body */
+        std::vector<std::pair<int, int>> _pendingJumps;     /* instruction index and the statement index it jumps to */
+
+        static std::unique_ptr<CompiledProgram> Compile(BoundProgram* program);
+
+        void CompileFunction(CompiledFunction& function, FunctionSymbol* symbol, BoundBlockStatement* body);
+        void PatchJumps();
+
+        void CompileStatement(BoundStatementNode* node);
+        void CompileVariableDeclaration(BoundVariableDeclaration* node);
+        void CompileConditionalGotoStatement(BoundConditionalGotoStatement* node);
+        void CompileReturnStatement(BoundReturnStatement* node);
+
+        /* Returns the register holding the result. When target is -1 the compiler is free to choose the register */
+        int CompileExpression(BoundExpressionNode* node, int target);
+        int CompileLiteralExpression(BoundLiteralExpression* node, int target);
+        int CompileVariableExpression(BoundVariableExpression* node, int target);
+        int CompileAssignmentExpression(BoundAssignmentExpression* node, int target);
+        int CompileUnaryExpression(BoundUnaryExpression* node, int target);
+        int CompileBinaryExpression(BoundBinaryExpression* node, int target);
+        int CompileShortCircuitExpression(BoundShortCircuitExpression* node, int target);
+        int CompileAppendExpression(BoundAppendExpression* node, int target);
+        int CompileConcatExpression(BoundConcatExpression* node, int target);
+        int CompileParts(const std::vector<std::unique_ptr<BoundExpressionNode>>& parts); /* Returns the register of the first part */
+        void CompileAppendParts(BoundAppendExpression* node);
+        int CompileCallExpression(BoundCallExpression* node, int target);
+        int CompileArguments(BoundCallExpression* node); /* Returns the register of the first argument */
+        int CompileConversionExpression(BoundConversionExpression* node, int target);
+
+        int Emit(OpCode op, int a = 0, int b = 0, int c = 0);
+        void EmitJump(OpCode op, int a, int target);
+        int AllocateRegister();
+        int TargetOrTemporary(int target);
+        int GlobalIndex(VariableSymbol* variable);
+        int NativeIndex(NativeFunction native);
+        int LocalRegister(VariableSymbol* variable);
+        bool IsLocal(VariableSymbol* variable);
+        static bool ContainsAssignment(BoundNode* node);
+    };
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <codeanalysis/utils/Value.hpp>
+#include <codeanalysis/utils/Symbol.hpp>
+#include <string>
+#include <vector>
+
+namespace trylang
+{
+    /*
+     *  Register based instruction set. R[x] is a register of the current frame, G[x] a global slot and K[x] a constant.
+     *  Operands which are not used by an instruction are left as 0.
+     */
+    enum class OpCode : unsigned char
+    {
+        LoadConstant,       /* R[a] = K[b] */
+        Move,               /* R[a] = R[b] */
+        LoadGlobal,         /* R[a] = G[b] */
+        StoreGlobal,        /* G[a] = R[b] */
+        Clear,              /* R[a] = none, releases the string R[a] was sharing */
+
+        AddInt,             /* R[a] = R[b] + R[c] */
+        SubtractInt,        /* R[a] = R[b] - R[c] */
+        MultiplyInt,        /* R[a] = R[b] * R[c] */
+        DivideInt,          /* R[a] = R[b] / R[c] */
+        Concat,             /* R[a] = string(R[b]) + string(R[b + 1]) + ... {c parts} */
+        AppendString,       /* R[a] += string(R[b]), in place while R[a] is the only owner of its string */
+        AppendGlobal,       /* G[a] += string(R[b]), in place while G[a] is the only owner of its string */
+
+        EqualsInt,          /* R[a] = R[b] == R[c] */
+        NotEqualsInt,       /* R[a] = R[b] != R[c] */
+        EqualsBool,
+        NotEqualsBool,
+        EqualsString,
+        NotEqualsString,
+        Less,               /* R[a] = R[b] < R[c] */
+        LessEquals,
+        Greater,
+        GreaterEquals,
+
+        Negate,             /* R[a] = -R[b] */
+        LogicalNot,         /* R[a] = !R[b] */
+
+        ToBool,             /* R[a] = bool(R[b]) */
+        ToInt,              /* R[a] = int(R[b]) */
+        ToString,           /* R[a] = string(R[b]) */
+
+        Jump,               /* pc = a */
+        JumpIfFalse,        /* if(!R[a]) pc = b */
+        JumpIfTrue,         /* if(R[a]) pc = b */
+
+        Call,               /* R[a] = F[b](R[c], R[c + 1], ...). The callee frame starts at R[c] */
+        TailCall,           /* return F[b](R[c], R[c + 1], ...). The callee replaces the current frame */
+        Print,              /* R[a] = print(R[b]) */
+        PrintParts,         /* R[a] = print(string(R[b]) + string(R[b + 1]) + ... {c parts}), written without building the string */
+        Input,              /* R[a] = input() */
+        Lines,              /* R[a] = lines() */
+        CallNative,         /* R[a] = natives[b](R[c], R[c + 1], ...) */
+        Return              /* return R[a], or the default value 0 when a is -1 */
+    };
+
+    struct Instruction
+    {
+        OpCode _op;
+        int _a = 0;
+        int _b = 0;
+        int _c = 0;
+    };
+
+    struct CompiledFunction
+    {
+        std::string _name;
+        int _arity = 0;
+        int _registerCount = 0;  /* parameters, locals and temporaries */
+        std::vector<Instruction> _code;
+    };
+
+    struct CompiledProgram
+    {
+        std::vector<Value> _constants; /* The ConstantPool of the BoundProgram, LoadConstant uses BoundLiteralExpression::_constant */
+        std::vector<CompiledFunction> _functions; /* _functions[0] is the top level program */
+        std::vector<NativeFunction> _natives;     /* Builtins called by CallNative */
+        int _globalCount = 0;
+    };
+}
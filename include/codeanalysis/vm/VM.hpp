@@ -0,0 +1,32 @@
+#pragma once
+
+#include <codeanalysis/vm/Chunk.hpp>
+#include <codeanalysis/utils/Value.hpp>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace trylang
+{
+    struct CallFrame
+    {
+        const CompiledFunction* _function;
+        const Instruction* _returnAddress;  /* Instruction of the caller to resume at */
+        int _base;                          /* Index of R[0] inside _registers */
+        int _returnRegister;                /* Caller register which receives the returned value */
+    };
+
+    /* Executes a CompiledProgram. Calls are kept on _frames instead of the C++ stack */
+    struct VM
+    {
+        std::unique_ptr<CompiledProgram> _program;
+        std::vector<Value> _globals;
+        std::vector<Value> _registers;
+        std::vector<CallFrame> _frames;
+        std::size_t _maxCallDepth;
+
+        VM(std::unique_ptr<CompiledProgram> program, std::size_t maxCallDepth);
+
+        Value Run();
+    };
+}
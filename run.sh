@@ -21,11 +21,25 @@ project_build() {
 project_run_exe() {
     if [ -z $2 ]; then
         echo "Error: No filename provided."
-        echo "Usage: $0 project-run-exe <file_name>"
+        echo "Usage: $0 project-run-exe <file_name> [options]"
         exit 1
     fi
 
-    ./build/executable -i $2
+    ./build/executable -i $2 "${@:3}"
+}
+
+# Function to time the executable with every execution engine
+project_bench() {
+    if [ -z $2 ]; then
+        echo "Error: No filename provided."
+        echo "Usage: $0 project-bench <file_name> [options]"
+        exit 1
+    fi
+
+    for engine in tree vm closure; do
+        echo "engine: $engine"
+        time ./build/executable -i $2 --engine=$engine "${@:3}" > /dev/null
+    done
 }
 
 # Function to run the executable with gdb
@@ -53,10 +67,13 @@ case "$1" in
     project-run-exe)
         project_run_exe $@
         ;;
+    project-bench)
+        project_bench $@
+        ;;
     project-run-debugger)
         project_run_debugger $@
         ;;
     *)
-        echo "Usage: $0 {project-configure-fresh|project-configure|project-build|project-run-exe <file_name>|project-run-debugger <file_name>}"
+        echo "Usage: $0 {project-configure-fresh|project-configure|project-build|project-run-exe <file_name> [options]|project-bench <file_name> [options]|project-run-debugger <file_name>}"
         exit 1
 esac
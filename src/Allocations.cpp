@@ -0,0 +1,52 @@
+#include <codeanalysis/utils/Allocations.hpp>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    void* Allocate(std::size_t size)
+    {
+        if(trylang::Allocations::_counting.load(std::memory_order_relaxed))
+        {
+            trylang::Allocations::_count.fetch_add(1, std::memory_order_relaxed);
+            trylang::Allocations::_bytes.fetch_add(size, std::memory_order_relaxed);
+        }
+
+        /* malloc(0) may return nullptr, operator new has to return a unique pointer */
+        if(auto* memory = std::malloc(size == 0 ? 1 : size))
+        {
+            return memory;
+        }
+        throw std::bad_alloc();
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    return Allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return Allocate(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
@@ -39,15 +39,24 @@ namespace trylang
                 auto parameter_sp = std::make_shared<ParameterSymbol>(parameter);
                 _scope->TryDeclareVariable(parameter_sp);
             }
+
+            /* Parameters occupy the first slots of the frame, locals follow them */
+            _localCount = static_cast<int>(_function->_parameters.size());
+            _frameSize = _localCount;
         }
 
-        (void)_scope->TryDeclareFunction(BUILT_IN_FUNCTIONS::MAP.at("print"));
-        (void)_scope->TryDeclareFunction(BUILT_IN_FUNCTIONS::MAP.at("input"));
+        for(const auto& builtin: BUILT_IN_FUNCTIONS::MAP)
+        {
+            (void)_scope->TryDeclareFunction(builtin.second);
+        }
     }
 
     std::unique_ptr<BoundProgram> Binder::BindProgram(CompilationUnitSyntax* syntaxTree)
     {
+        auto constants = std::make_unique<ConstantPool>();
         Binder binder(nullptr, nullptr);
+        binder._constants = constants.get();
+        binder._tokens = &syntaxTree->_tokens;
         std::vector<std::unique_ptr<BoundStatementNode>> statements;
 
         for(const auto& member: syntaxTree->_statements)
@@ -71,7 +80,7 @@ namespace trylang
         scope->_variables = std::move(binder._scope->_variables);
 
         std::unordered_map<std::string, std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>> functionBodies;
-        auto flattened = Lower::RewriteAndFlatten(std::move(statement));
+        auto flattened = Lower::RewriteAndFlatten(std::move(statement), nullptr, binder._globalCount);
 
         for(const auto& function: scope->_functions)
         {
@@ -82,10 +91,14 @@ namespace trylang
             }
 
             Binder binder(scope, function.second.get());
+            binder._constants = constants.get();
+            binder._tokens = &syntaxTree->_tokens;
             auto body = binder.BindStatement(function.second->_declaration->_body.get());
-            auto flattenedBody = Lower::RewriteAndFlatten(std::move(body));
+            auto flattenedBody = Lower::RewriteAndFlatten(std::move(body), function.second.get(), binder._frameSize);
 
-            functionBodies[function.first] = std::make_pair(function.second, std::move(flattenedBody));
+            function.second->_body = flattenedBody.get();
+            function.second->_frameSize = binder._frameSize;
+            functionBodies[function.second->_name] = std::make_pair(function.second, std::move(flattenedBody));
 
             errors.append(Binder::Errors());
         }
@@ -98,7 +111,7 @@ namespace trylang
         }
         else
         {
-            boundProgram = std::make_unique<BoundProgram>(std::move(scope->_variables), std::move(functionBodies), std::move(flattened));
+            boundProgram = std::make_unique<BoundProgram>(std::move(scope->_variables), std::move(functionBodies), std::move(flattened), binder._globalCount, std::move(constants));
         }
 
         return boundProgram;
@@ -131,7 +144,7 @@ namespace trylang
 
     std::unique_ptr<BoundStatementNode> Binder::BindVariableDeclaration(VariableDeclarationStatementSyntax *syntax)
     {
-        auto isReadOnly = syntax->_keyword->Kind() == SyntaxKind::LetKeyword;
+        auto isReadOnly = _tokens->Kind(syntax->_keyword) == SyntaxKind::LetKeyword;
         const char* type = this->BindTypeClause(syntax->_typeClause.get());
         auto expression = this->BindExpression(syntax->_expression.get());
         auto variableType = type == nullptr ? expression->Type() : type;
@@ -139,11 +152,11 @@ namespace trylang
         std::shared_ptr<VariableSymbol> variable = nullptr;
         if(_scope->_parent == nullptr && expression->Kind() == BoundNodeKind::LiteralExpression)
         {
-            variable = this->BindVariable(syntax->_identifier->_text, isReadOnly, variableType);
+            variable = this->BindVariable(std::string(_tokens->Text(syntax->_identifier)), isReadOnly, variableType);
         }
         else
         {
-            variable = this->BindVariable(syntax->_identifier->_text, isReadOnly, variableType);
+            variable = this->BindVariable(std::string(_tokens->Text(syntax->_identifier)), isReadOnly, variableType);
         }
         
         if(variable == nullptr)
@@ -161,11 +174,12 @@ namespace trylang
         std::shared_ptr<VariableSymbol> variable = nullptr;
         if(_function == nullptr)
         {
-            variable = std::make_shared<GlobalVariableSymbol>(std::move(varName), isReadOnly, type);
+            variable = std::make_shared<GlobalVariableSymbol>(std::move(varName), isReadOnly, type, _globalCount++);
         }
         else
         {
-            variable = std::make_shared<LocalVariableSymbol>(std::move(varName), isReadOnly, type);
+            variable = std::make_shared<LocalVariableSymbol>(std::move(varName), isReadOnly, type, _localCount++);
+            _frameSize = std::max(_frameSize, _localCount);
         }
         
         if(!_scope->TryDeclareVariable(variable))
@@ -183,10 +197,10 @@ namespace trylang
             return nullptr;
         }
 
-        auto* type = trylang::LookUpType(syntax->_identifierToken->_text);
+        auto* type = trylang::LookUpType(_tokens->Text(syntax->_identifierToken));
         if(type == nullptr)
         {
-            _buffer << "Type '" << syntax->_identifierToken->_text <<  "' doesn't exists.\n";
+            _buffer << "Type '" << _tokens->Text(syntax->_identifierToken) <<  "' doesn't exists.\n";
             return nullptr;
         }
 
@@ -198,6 +212,7 @@ namespace trylang
         std::vector<std::unique_ptr<BoundStatementNode>> statements;
 
         _scope = std::make_shared<BoundScope>(_scope);
+        auto localCount = _localCount;
 
         for(const auto& statementSyntax: syntax->_statements)
         {
@@ -205,6 +220,8 @@ namespace trylang
             statements.emplace_back(std::move(statement));
         }
 
+        /* Locals of this block are dead now, so sibling blocks can reuse their slots */
+        _localCount = localCount;
         _scope = _scope->_parent;
 
         return std::make_unique<BoundBlockStatement>(std::move(statements));
@@ -265,7 +282,7 @@ namespace trylang
 
     std::unique_ptr<BoundExpressionNode> Binder::BindNameExpression(NameExpressionSyntax *syntax)
     {
-        const auto& varname = syntax->_identifierToken->_text;
+        auto varname = _tokens->Text(syntax->_identifierToken);
 
         auto variable = _scope->TryLookUpVariable(varname);
         if(variable == nullptr)
@@ -282,7 +299,7 @@ namespace trylang
      * */
     std::unique_ptr<BoundExpressionNode> Binder::BindAssignmentExpression(AssignmentExpressionSyntax *syntax)
     {
-        const auto& varname = syntax->_identifierToken->_text;
+        auto varname = _tokens->Text(syntax->_identifierToken);
         auto boundExpression = this->BindExpression(syntax->_expression.get());
 
         auto variable = _scope->TryLookUpVariable(varname);
@@ -290,7 +307,7 @@ namespace trylang
         {
             /* We did not have varname variable declared */
             _buffer << "Undefined Name " << varname << "\n";
-            return std::make_unique<BoundLiteralExpression>(0);
+            return this->BindLiteral(0);
         }
 
         /* varname variable is declared already */
@@ -316,10 +333,15 @@ namespace trylang
 
         if(syntax->_value.has_value())
         {
-            return std::make_unique<BoundLiteralExpression>(syntax->_value);
+            return this->BindLiteral(Value::FromObject(syntax->_value));
         }
 
-        return std::make_unique<BoundLiteralExpression>(value);
+        return this->BindLiteral(value);
+    }
+
+    std::unique_ptr<BoundExpressionNode> Binder::BindLiteral(const Value& value)
+    {
+        return std::make_unique<BoundLiteralExpression>(*_constants, _constants->Add(value));
     }
 
     std::unique_ptr<BoundExpressionNode> Binder::BindUnaryExpression(UnaryExpressionSyntax* syntax)
@@ -332,11 +354,11 @@ namespace trylang
             return std::make_unique<BoundErrorExpression>();
         }
 
-        auto boundOperatorKind = BoundUnaryOperator::Bind(syntax->_operatorToken->Kind(),boundOperand->Type());
+        auto boundOperatorKind = BoundUnaryOperator::Bind(_tokens->Kind(syntax->_operatorToken),boundOperand->Type());
 
         if(boundOperatorKind == nullptr)
         {
-            _buffer << "Unary operator '" << syntax->_operatorToken->_text << "' is not defined for type " << boundOperand->Type() << "\n";
+            _buffer << "Unary operator '" << _tokens->Text(syntax->_operatorToken) << "' is not defined for type " << boundOperand->Type() << "\n";
             return std::make_unique<BoundErrorExpression>();
         }
 
@@ -354,17 +376,56 @@ namespace trylang
             return std::make_unique<BoundErrorExpression>();
         }
 
-        auto boundOperatorKind = BoundBinaryOperator::Bind(syntax->_operatorToken->Kind(), boundLeft->Type(), boundRight->Type());
+        auto boundOperatorKind = BoundBinaryOperator::Bind(_tokens->Kind(syntax->_operatorToken), boundLeft->Type(), boundRight->Type());
         
         if(boundOperatorKind == nullptr)
         {
-            _buffer << "Binary operator '" << syntax->_operatorToken->_text << "' is not defined for types " << boundLeft->Type() << " and " << boundRight->Type() << "\n";
+            _buffer << "Binary operator '" << _tokens->Text(syntax->_operatorToken) << "' is not defined for types " << boundLeft->Type() << " and " << boundRight->Type() << "\n";
             return std::make_unique<BoundErrorExpression>();
         }
 
+        if(boundOperatorKind->_kind == BoundNodeKind::Addition && std::strcmp(boundOperatorKind->_resultType, Types::STRING->Name()) == 0)
+        {
+            return this->BindConcatExpression(std::move(boundLeft), std::move(boundRight));
+        }
+
         return std::make_unique<BoundBinaryExpression>(std::move(boundLeft), boundOperatorKind, std::move(boundRight));
     }
 
+    namespace
+    {
+        /* Adds expression to the parts of a BoundConcatExpression, flattening nested concatenations */
+        void AddConcatPart(std::vector<std::unique_ptr<BoundExpressionNode>>& parts, std::unique_ptr<BoundExpressionNode> expression)
+        {
+            if(expression->Kind() == BoundNodeKind::ConcatExpression)
+            {
+                for(auto& part: static_cast<BoundConcatExpression*>(expression.get())->_parts)
+                {
+                    parts.emplace_back(std::move(part));
+                }
+            }
+            else if(expression->Kind() == BoundNodeKind::ConversionExpression && std::strcmp(expression->Type(), Types::STRING->Name()) == 0)
+            {
+                /* string(n) is formatted in place by the concatenation, no intermediate string is needed */
+                parts.emplace_back(std::move(static_cast<BoundConversionExpression*>(expression.get())->_expression));
+            }
+            else
+            {
+                parts.emplace_back(std::move(expression));
+            }
+        }
+    }
+
+    /* Fuses a chain of string additions into a single BoundConcatExpression, parts keep their left to right order */
+    std::unique_ptr<BoundExpressionNode> Binder::BindConcatExpression(std::unique_ptr<BoundExpressionNode> left, std::unique_ptr<BoundExpressionNode> right)
+    {
+        std::vector<std::unique_ptr<BoundExpressionNode>> parts;
+        AddConcatPart(parts, std::move(left));
+        AddConcatPart(parts, std::move(right));
+
+        return std::make_unique<BoundConcatExpression>(std::move(parts));
+    }
+
     std::unique_ptr<BoundStatementNode> Binder::BindIfStatement(trylang::IfStatementSyntax *syntax)
     {
         auto condition = this->BindExpression(syntax->_condition.get(), Types::BOOL->Name());
@@ -410,7 +471,7 @@ namespace trylang
 
         _scope = std::make_shared<BoundScope>(_scope);
 
-        auto variable = this->BindVariable(syntax->_identifier->_text, true, Types::INT->Name());
+        auto variable = this->BindVariable(std::string(_tokens->Text(syntax->_identifier)), true, Types::INT->Name());
         if(variable == nullptr)
         {
             return this->BindErrorStatement();
@@ -472,12 +533,17 @@ namespace trylang
     std::unique_ptr<BoundExpressionNode> Binder::BindCallExpression(CallExpressionSyntax *syntax)
     {
 
-        auto* type = trylang::LookUpType(syntax->_identifier->_text);
+        auto* type = trylang::LookUpType(_tokens->Text(syntax->_identifier));
         if(syntax->_arguments.size() == 1 && type != nullptr)
         {
             return this->BindConversion(type->_typeName, syntax->_arguments[0].get(), /* allowExplicit */ true);
         }
 
+        if(_tokens->Text(syntax->_identifier) == BUILT_IN_FUNCTIONS::FORMAT)
+        {
+            return this->BindFormatExpression(syntax);
+        }
+
         std::vector<std::unique_ptr<BoundExpressionNode>> boundArguments;
         for(const auto& expr: syntax->_arguments)
         {
@@ -485,16 +551,16 @@ namespace trylang
             boundArguments.emplace_back(std::move(boundExpr));
         }
 
-        auto function = _scope->TryLookUpFunction(syntax->_identifier->_text);
+        auto function = _scope->TryLookUpFunction(_tokens->Text(syntax->_identifier));
         if(function == nullptr)
         {
-            _buffer << "Function '" << syntax->_identifier->_text << "' doesn't exist\n";
+            _buffer << "Function '" << _tokens->Text(syntax->_identifier) << "' doesn't exist\n";
             return std::make_unique<BoundErrorExpression>();
         }
 
         if(syntax->_arguments.size() != function->_parameters.size())
         {
-            _buffer << "Wrong No.of Arguments Reported in function call " << syntax->_identifier->_text << "\n";
+            _buffer << "Wrong No.of Arguments Reported in function call " << _tokens->Text(syntax->_identifier) << "\n";
             return std::make_unique<BoundErrorExpression>();
         }
 
@@ -505,12 +571,99 @@ namespace trylang
 
             if(argument->Type() != parameter._type)
             {
-                _buffer << "Wrong Argument Type provided in function call " << syntax->_identifier->_text << "\n";
+                _buffer << "Wrong Argument Type provided in function call " << _tokens->Text(syntax->_identifier) << "\n";
                 return std::make_unique<BoundErrorExpression>();
             }
         }
 
-        return std::make_unique<BoundCallExpression>(std::make_unique<FunctionSymbol>(*function), std::move(boundArguments));
+        /* Sharing the declared symbol lets the callers reach the body and the frame size once the function is bound */
+        return std::make_unique<BoundCallExpression>(function, std::move(boundArguments));
+    }
+
+    /*
+     *  format("{} scored {}", name, n) is compiled here, once: the text between the placeholders becomes constants and
+     *  each {} the next argument, giving the concatenation name + " scored " + string(n). Value::Concatenate writes it
+     *  into a single string and a print() of it goes straight to the output buffer. {{ and }} stand for { and }
+     * */
+    std::unique_ptr<BoundExpressionNode> Binder::BindFormatExpression(CallExpressionSyntax *syntax)
+    {
+        const auto& arguments = syntax->_arguments;
+        auto* literal = arguments.empty() || arguments[0]->Kind() != SyntaxKind::LiteralExpression ? nullptr : static_cast<LiteralExpressionSyntax*>(arguments[0].get());
+        if(literal == nullptr || !literal->_value.has_value() || !std::holds_alternative<std::string>(*literal->_value))
+        {
+            _buffer << "The first argument of format() must be a string literal\n";
+            return std::make_unique<BoundErrorExpression>();
+        }
+
+        const auto& pattern = std::get<std::string>(*literal->_value);
+        std::vector<std::unique_ptr<BoundExpressionNode>> parts;
+        std::string text;
+        std::size_t placeholders = 0;
+
+        for(std::size_t i = 0; i < pattern.size(); i++)
+        {
+            auto ch = pattern[i];
+            auto following = i + 1 < pattern.size() ? pattern[i + 1] : '\0';
+
+            if((ch == '{' || ch == '}') && following == ch)
+            {
+                text.push_back(ch);
+                i++;
+            }
+            else if(ch == '{' && following == '}')
+            {
+                i++;
+                if(++placeholders >= arguments.size())
+                {
+                    continue; /* Reported below with the number of placeholders */
+                }
+
+                if(!text.empty())
+                {
+                    parts.emplace_back(this->BindLiteral(Value(std::move(text))));
+                    text.clear();
+                }
+
+                auto argument = this->BindExpression(arguments[placeholders].get());
+                if(std::strcmp(argument->Type(), Types::ERROR->Name()) == 0)
+                {
+                    return argument;
+                }
+                AddConcatPart(parts, std::move(argument));
+            }
+            else if(ch == '{' || ch == '}')
+            {
+                _buffer << "Invalid format string \"" << pattern << "\": a single '" << ch << "' must be written '" << ch << ch << "'\n";
+                return std::make_unique<BoundErrorExpression>();
+            }
+            else
+            {
+                text.push_back(ch);
+            }
+        }
+
+        if(placeholders != arguments.size() - 1)
+        {
+            _buffer << "The format string of format() has " << placeholders << " placeholders for " << arguments.size() - 1 << " values\n";
+            return std::make_unique<BoundErrorExpression>();
+        }
+
+        if(!text.empty())
+        {
+            parts.emplace_back(this->BindLiteral(Value(std::move(text))));
+        }
+
+        if(parts.empty())
+        {
+            return this->BindLiteral(Value(std::string()));
+        }
+
+        if(parts.size() == 1 && std::strcmp(parts[0]->Type(), Types::STRING->Name()) == 0)
+        {
+            return std::move(parts[0]);
+        }
+
+        return std::make_unique<BoundConcatExpression>(std::move(parts));
     }
 
     void Binder::BindFunctionDeclaration(FunctionDeclarationStatementSyntax *syntax)
@@ -520,7 +673,7 @@ namespace trylang
 
         for(const auto& parameterSyntax: syntax->_parameters)
         {
-            const auto& parameterName = parameterSyntax->_identifier->_text;
+            auto parameterName = _tokens->Text(parameterSyntax->_identifier);
             auto parameterType = this->BindTypeClause(parameterSyntax->_type.get());
 
             if(std::find(seenParameterNames.begin(), seenParameterNames.end(), parameterName) != seenParameterNames.end())
@@ -529,7 +682,7 @@ namespace trylang
             }
             else
             {
-                ParameterSymbol parameter(parameterName, true ,parameterType);
+                ParameterSymbol parameter(std::string(parameterName), true ,parameterType, static_cast<int>(parameters.size()));
                 parameters.emplace_back(std::move(parameter));
             }
 
@@ -542,10 +695,10 @@ namespace trylang
             returnType = Types::INT->Name();
         }
 
-        auto function = std::make_shared<FunctionSymbol>(syntax->_identifier->_text, std::move(parameters), returnType, syntax);
-        if(!_scope->TryDeclareFunction(function))
+        auto function = std::make_shared<FunctionSymbol>(std::string(_tokens->Text(syntax->_identifier)), std::move(parameters), returnType, syntax);
+        if(function->_name == BUILT_IN_FUNCTIONS::FORMAT || !_scope->TryDeclareFunction(function))
         {
-            _buffer << "Function '" << syntax->_identifier->_text << "' already declared\n";
+            _buffer << "Function '" << _tokens->Text(syntax->_identifier) << "' already declared\n";
         }
     }
 
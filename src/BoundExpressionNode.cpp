@@ -39,29 +39,29 @@ namespace trylang
     };
 
     std::array<std::unique_ptr<BoundBinaryOperator>, 17> _boundBinaryOperatorArray = {
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::PlusToken, BoundNodeKind::Addition, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::MinusToken, BoundNodeKind::Subtraction, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::SlashToken, BoundNodeKind::Division, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::StarToken, BoundNodeKind::Multiplication, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
+            std::make_unique<BoundAddIntOperator>(SyntaxKind::PlusToken, BoundNodeKind::Addition, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
+            std::make_unique<BoundSubtractIntOperator>(SyntaxKind::MinusToken, BoundNodeKind::Subtraction, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
+            std::make_unique<BoundDivideIntOperator>(SyntaxKind::SlashToken, BoundNodeKind::Division, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
+            std::make_unique<BoundMultiplyIntOperator>(SyntaxKind::StarToken, BoundNodeKind::Multiplication, Types::INT->Name(),Types::INT->Name(), Types::INT->Name()),
 
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::EqualsEqualsToken, BoundNodeKind::LogicalEquality, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::BangsEqualsToken, BoundNodeKind::LogicalNotEquality, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundEqualsIntOperator>(SyntaxKind::EqualsEqualsToken, BoundNodeKind::LogicalEquality, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundNotEqualsIntOperator>(SyntaxKind::BangsEqualsToken, BoundNodeKind::LogicalNotEquality, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
 
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::LessThanToken, BoundNodeKind::Less, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::LessThanEqualsToken, BoundNodeKind::LessEquals, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::GreaterThanToken, BoundNodeKind::Greater, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::GreaterThanEqualsToken, BoundNodeKind::GreaterEquals, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundLessIntOperator>(SyntaxKind::LessThanToken, BoundNodeKind::Less, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundLessEqualsIntOperator>(SyntaxKind::LessThanEqualsToken, BoundNodeKind::LessEquals, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundGreaterIntOperator>(SyntaxKind::GreaterThanToken, BoundNodeKind::Greater, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundGreaterEqualsIntOperator>(SyntaxKind::GreaterThanEqualsToken, BoundNodeKind::GreaterEquals, Types::INT->Name(),Types::INT->Name(), Types::BOOL->Name()),
 
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::AmpersandAmpersandToken, BoundNodeKind::LogicalAnd, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::PipePipeToken, BoundNodeKind::LogicalOr, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundAndBoolOperator>(SyntaxKind::AmpersandAmpersandToken, BoundNodeKind::LogicalAnd, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundOrBoolOperator>(SyntaxKind::PipePipeToken, BoundNodeKind::LogicalOr, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
 
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::EqualsEqualsToken, BoundNodeKind::LogicalEquality, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::BangsEqualsToken, BoundNodeKind::LogicalNotEquality, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundEqualsBoolOperator>(SyntaxKind::EqualsEqualsToken, BoundNodeKind::LogicalEquality, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundNotEqualsBoolOperator>(SyntaxKind::BangsEqualsToken, BoundNodeKind::LogicalNotEquality, Types::BOOL->Name(),Types::BOOL->Name(), Types::BOOL->Name()),
 
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::EqualsEqualsToken, BoundNodeKind::LogicalEquality, Types::STRING->Name(),Types::STRING->Name(), Types::BOOL->Name()),
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::BangsEqualsToken, BoundNodeKind::LogicalNotEquality, Types::STRING->Name(),Types::STRING->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundEqualsStringOperator>(SyntaxKind::EqualsEqualsToken, BoundNodeKind::LogicalEquality, Types::STRING->Name(),Types::STRING->Name(), Types::BOOL->Name()),
+            std::make_unique<BoundNotEqualsStringOperator>(SyntaxKind::BangsEqualsToken, BoundNodeKind::LogicalNotEquality, Types::STRING->Name(),Types::STRING->Name(), Types::BOOL->Name()),
 
-            std::make_unique<BoundBinaryOperator>(SyntaxKind::PlusToken, BoundNodeKind::Addition, Types::STRING->Name(),Types::STRING->Name(), Types::STRING->Name())
+            std::make_unique<BoundAddStringOperator>(SyntaxKind::PlusToken, BoundNodeKind::Addition, Types::STRING->Name(),Types::STRING->Name(), Types::STRING->Name())
 
     };
 
@@ -180,13 +180,23 @@ namespace trylang
         return {_expression.get()};
     }
 
-    BoundLiteralExpression::BoundLiteralExpression(const object_t& value)
-        : _value(value)
+    BoundLiteralExpression::BoundLiteralExpression(const ConstantPool& constants, int constant)
+        : _value(constants._values[constant]), _constant(constant)
     {}
 
     const char* BoundLiteralExpression::Type()
     {   
-        return trylang::assign_type_info(*_value);
+        switch(_value._tag)
+        {
+            case Value::Tag::Int:
+                return Types::INT->Name();
+            case Value::Tag::Bool:
+                return Types::BOOL->Name();
+            case Value::Tag::String:
+                return Types::STRING->Name();
+            default:
+                throw std::logic_error("Unexpected type_info");
+        }
     }
 
     BoundNodeKind BoundLiteralExpression::Kind()
@@ -218,6 +228,75 @@ namespace trylang
         return {_left.get(), _op, _right.get()};
     }
 
+    BoundShortCircuitExpression::BoundShortCircuitExpression(std::unique_ptr<BoundExpressionNode> left, BoundBinaryOperator* op, std::unique_ptr<BoundExpressionNode> right)
+        : _left(std::move(left)), _op(op), _right(std::move(right))
+    {}
+
+    const char* BoundShortCircuitExpression::Type()
+    {
+        return _op->_resultType;
+    }
+
+    BoundNodeKind BoundShortCircuitExpression::Kind()
+    {
+        return BoundNodeKind::ShortCircuitExpression;
+    }
+
+    std::vector<BoundNode *> BoundShortCircuitExpression::GetChildren()
+    {
+        return {_left.get(), _op, _right.get()};
+    }
+
+    BoundConcatExpression::BoundConcatExpression(std::vector<std::unique_ptr<BoundExpressionNode>> parts)
+        : _parts(std::move(parts))
+    {}
+
+    const char* BoundConcatExpression::Type()
+    {
+        return Types::STRING->Name();
+    }
+
+    BoundNodeKind BoundConcatExpression::Kind()
+    {
+        return BoundNodeKind::ConcatExpression;
+    }
+
+    std::vector<BoundNode *> BoundConcatExpression::GetChildren()
+    {
+        std::vector<BoundNode*> children;
+        for(const auto& part: _parts)
+        {
+            children.emplace_back(part.get());
+        }
+
+        return children;
+    }
+
+    BoundAppendExpression::BoundAppendExpression(const std::shared_ptr<VariableSymbol>& variable, std::vector<std::unique_ptr<BoundExpressionNode>> parts)
+        : _variable(variable), _parts(std::move(parts))
+    {}
+
+    const char* BoundAppendExpression::Type()
+    {
+        return _variable->_type;
+    }
+
+    BoundNodeKind BoundAppendExpression::Kind()
+    {
+        return BoundNodeKind::AppendExpression;
+    }
+
+    std::vector<BoundNode *> BoundAppendExpression::GetChildren()
+    {
+        std::vector<BoundNode*> children;
+        for(const auto& part: _parts)
+        {
+            children.emplace_back(part.get());
+        }
+
+        return children;
+    }
+
     BoundVariableExpression::BoundVariableExpression(const std::shared_ptr<VariableSymbol>& variable)
         : _variable(variable)
     {}
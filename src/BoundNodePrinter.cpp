@@ -77,6 +77,21 @@ namespace trylang
                 this->WriteConversionExpression(static_cast<BoundConversionExpression*>(node));
                 break;
             }
+            case BoundNodeKind::ShortCircuitExpression:
+            {
+                this->WriteShortCircuitExpression(static_cast<BoundShortCircuitExpression*>(node));
+                break;
+            }
+            case BoundNodeKind::ConcatExpression:
+            {
+                this->WriteConcatExpression(static_cast<BoundConcatExpression*>(node));
+                break;
+            }
+            case BoundNodeKind::AppendExpression:
+            {
+                this->WriteAppendExpression(static_cast<BoundAppendExpression*>(node));
+                break;
+            }
             case BoundNodeKind::BlockStatement:
             {
                 this->WriteBlockStatement(static_cast<BoundBlockStatement*>(node));
@@ -148,15 +163,15 @@ namespace trylang
     {
         if(std::strcmp(Types::INT->Name(), node->Type()) == 0)
         {
-            _buffer << _indentation << std::get<int>(*node->_value);
+            _buffer << _indentation << node->_value.AsInt();
         }
         else if(std::strcmp(Types::BOOL->Name(), node->Type()) == 0)
         {
-            _buffer << _indentation << std::boolalpha << std::get<bool>(*node->_value);
+            _buffer << _indentation << std::boolalpha << node->_value.AsBool();
         }
         else if(std::strcmp(Types::STRING->Name(), node->Type()) == 0)
         {
-            _buffer << _indentation << "\"" << std::get<std::string>(*node->_value) << "\"";
+            _buffer << _indentation << "\"" << node->_value.AsString() << "\"";
         }
         else
         {
@@ -221,6 +236,40 @@ namespace trylang
         _buffer << ")";
     }
 
+    void NodePrinter::WriteShortCircuitExpression(BoundShortCircuitExpression* node)
+    {
+        this->WriteTo(node->_left.get());
+        _buffer << _indentation << " @" << node->_op->Kind() << "@ ";
+        this->WriteTo(node->_right.get());
+    }
+
+    void NodePrinter::WriteConcatExpression(BoundConcatExpression* node)
+    {
+        _buffer << _indentation << "concat(";
+        for(auto i = 0; i < node->_parts.size(); i++)
+        {
+            if(i != 0)
+            {
+                _buffer << ", ";
+            }
+            this->WriteTo(node->_parts[i].get());
+        }
+        _buffer << ")";
+    }
+
+    void NodePrinter::WriteAppendExpression(BoundAppendExpression* node)
+    {
+        _buffer << _indentation << node->_variable->_name << " += ";
+        for(auto i = 0; i < node->_parts.size(); i++)
+        {
+            if(i != 0)
+            {
+                _buffer << " + ";
+            }
+            this->WriteTo(node->_parts[i].get());
+        }
+    }
+
     void NodePrinter::WriteBlockStatement(BoundBlockStatement* node)
     {
         _buffer << _indentation << "{\n";
@@ -324,7 +373,7 @@ namespace trylang
 
     void NodePrinter::WriteReturnStatement(BoundReturnStatement* node)
     {
-        _buffer << _indentation << "return ";
+        _buffer << _indentation << (node->_isTailCall ? "tail return " : "return ");
         this->WriteTo(node->_expression.get());
         _buffer << "\n";
     }
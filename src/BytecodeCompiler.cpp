@@ -0,0 +1,587 @@
+#include <codeanalysis/vm/BytecodeCompiler.hpp>
+#include <codeanalysis/binder/utils/BoundExpressionNode.hpp>
+#include <codeanalysis/binder/utils/BoundNodeKind.hpp>
+#include <codeanalysis/binder/utils/BoundProgram.hpp>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace trylang
+{
+    std::unique_ptr<CompiledProgram> BytecodeCompiler::Compile(BoundProgram* program)
+    {
+        BytecodeCompiler compiler;
+        compiler._program = std::make_unique<CompiledProgram>();
+        compiler._program->_constants.assign(program->_constants->_values.begin(), program->_constants->_values.end());
+
+        /* Index 0 is reserved for the top level program so that function indices are known before any call is compiled */
+        compiler._program->_functions.resize(program->_functionsInfoAndBody.size() + 1);
+        compiler._program->_functions[0]._name = "<main>";
+
+        int index = 1;
+        for(const auto& function: program->_functionsInfoAndBody)
+        {
+            compiler._functionIndices[function.first] = index++;
+        }
+
+        compiler.CompileFunction(compiler._program->_functions[0], nullptr, program->_statement.get());
+
+        for(const auto& function: program->_functionsInfoAndBody)
+        {
+            auto& compiled = compiler._program->_functions[compiler._functionIndices.at(function.first)];
+            compiler.CompileFunction(compiled, function.second.first.get(), function.second.second.get());
+        }
+
+        compiler._program->_globalCount = program->_globalCount;
+
+        return std::move(compiler._program);
+    }
+
+    void BytecodeCompiler::CompileFunction(CompiledFunction& function, FunctionSymbol* symbol, BoundBlockStatement* body)
+    {
+        _function = &function;
+        _functionSymbol = symbol;
+        _statementPcs.clear();
+        _pendingJumps.clear();
+        _lastValueRegister = -1;
+
+        if(symbol != nullptr)
+        {
+            function._name = symbol->_name;
+            function._arity = static_cast<int>(symbol->_parameters.size());
+        }
+
+        /* Registers [0, frameSize) are the frame slots assigned by the Binder {parameters first}, then come the temporaries */
+        _nextRegister = symbol == nullptr ? 0 : symbol->_frameSize;
+
+        if(symbol == nullptr)
+        {
+            _lastValueRegister = this->AllocateRegister();
+        }
+
+        _firstTemporary = _nextRegister;
+        function._registerCount = _nextRegister;
+
+        for(const auto& statement: body->_statements)
+        {
+            _statementPcs.push_back(static_cast<int>(_function->_code.size()));
+            this->CompileStatement(statement.get());
+            _nextRegister = _firstTemporary;
+        }
+
+        /* The top level program evaluates to the last value, functions always end with a return statement */
+        _statementPcs.push_back(static_cast<int>(_function->_code.size()));
+        this->Emit(OpCode::Return, _lastValueRegister);
+
+        this->PatchJumps();
+    }
+
+    void BytecodeCompiler::PatchJumps()
+    {
+        for(const auto& [instructionIndex, target]: _pendingJumps)
+        {
+            auto& instruction = _function->_code[instructionIndex];
+            if(instruction._op == OpCode::Jump)
+            {
+                instruction._a = _statementPcs[target];
+            }
+            else
+            {
+                instruction._b = _statementPcs[target];
+            }
+        }
+    }
+
+    void BytecodeCompiler::CompileStatement(BoundStatementNode* node)
+    {
+        switch(node->Kind())
+        {
+            case BoundNodeKind::VariableDeclarationStatement:
+                this->CompileVariableDeclaration(static_cast<BoundVariableDeclaration*>(node));
+                break;
+            case BoundNodeKind::ExpressionStatement:
+            {
+                auto* expression = static_cast<BoundExpressionStatement*>(node)->_expression.get();
+                if(_lastValueRegister == -1 && expression->Kind() == BoundNodeKind::AppendExpression)
+                {
+                    /* Nobody reads the result, loading it would only keep a second reference to the appended string */
+                    this->CompileAppendParts(static_cast<BoundAppendExpression*>(expression));
+                    break;
+                }
+
+                (void)this->CompileExpression(expression, _lastValueRegister);
+                break;
+            }
+            case BoundNodeKind::GotoStatement:
+                this->EmitJump(OpCode::Jump, 0, static_cast<BoundGotoStatement*>(node)->_target);
+                break;
+            case BoundNodeKind::ConditionalGotoStatement:
+                this->CompileConditionalGotoStatement(static_cast<BoundConditionalGotoStatement*>(node));
+                break;
+            case BoundNodeKind::LabelStatement:
+                break;
+            case BoundNodeKind::ReturnStatement:
+                this->CompileReturnStatement(static_cast<BoundReturnStatement*>(node));
+                break;
+            default:
+                throw std::logic_error("BytecodeCompiler: Unexpected node " + trylang::__boundNodeStringMap[node->Kind()]);
+        }
+    }
+
+    void BytecodeCompiler::CompileVariableDeclaration(BoundVariableDeclaration* node)
+    {
+        if(this->IsLocal(node->_variable.get()))
+        {
+            (void)this->CompileExpression(node->_expression.get(), this->LocalRegister(node->_variable.get()));
+            return;
+        }
+
+        auto value = this->CompileExpression(node->_expression.get(), _lastValueRegister);
+        this->Emit(OpCode::StoreGlobal, this->GlobalIndex(node->_variable.get()), value);
+    }
+
+    void BytecodeCompiler::CompileConditionalGotoStatement(BoundConditionalGotoStatement* node)
+    {
+        auto condition = this->CompileExpression(node->_condition.get(), -1);
+        this->EmitJump(node->_jumpIfFalse ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, condition, node->_target);
+    }
+
+    void BytecodeCompiler::CompileReturnStatement(BoundReturnStatement* node)
+    {
+        if(node->_expression == nullptr)
+        {
+            this->Emit(OpCode::Return, -1);
+            return;
+        }
+
+        if(node->_isTailCall)
+        {
+            auto* call = static_cast<BoundCallExpression*>(node->_expression.get());
+            auto firstArgument = this->CompileArguments(call);
+            this->Emit(OpCode::TailCall, 0, _functionIndices.at(call->_function->_name), firstArgument);
+            return;
+        }
+
+        auto value = this->CompileExpression(node->_expression.get(), -1);
+        this->Emit(OpCode::Return, value);
+    }
+
+    int BytecodeCompiler::CompileExpression(BoundExpressionNode* node, int target)
+    {
+        switch(node->Kind())
+        {
+            case BoundNodeKind::LiteralExpression:
+                return this->CompileLiteralExpression(static_cast<BoundLiteralExpression*>(node), target);
+            case BoundNodeKind::VariableExpression:
+                return this->CompileVariableExpression(static_cast<BoundVariableExpression*>(node), target);
+            case BoundNodeKind::AssignmentExpression:
+                return this->CompileAssignmentExpression(static_cast<BoundAssignmentExpression*>(node), target);
+            case BoundNodeKind::UnaryExpression:
+                return this->CompileUnaryExpression(static_cast<BoundUnaryExpression*>(node), target);
+            case BoundNodeKind::BinaryExpression:
+                return this->CompileBinaryExpression(static_cast<BoundBinaryExpression*>(node), target);
+            case BoundNodeKind::ShortCircuitExpression:
+                return this->CompileShortCircuitExpression(static_cast<BoundShortCircuitExpression*>(node), target);
+            case BoundNodeKind::AppendExpression:
+                return this->CompileAppendExpression(static_cast<BoundAppendExpression*>(node), target);
+            case BoundNodeKind::ConcatExpression:
+                return this->CompileConcatExpression(static_cast<BoundConcatExpression*>(node), target);
+            case BoundNodeKind::CallExpression:
+                return this->CompileCallExpression(static_cast<BoundCallExpression*>(node), target);
+            case BoundNodeKind::ConversionExpression:
+                return this->CompileConversionExpression(static_cast<BoundConversionExpression*>(node), target);
+            default:
+                throw std::logic_error("BytecodeCompiler: Unexpected node " + trylang::__boundNodeStringMap[node->Kind()]);
+        }
+    }
+
+    int BytecodeCompiler::CompileLiteralExpression(BoundLiteralExpression* node, int target)
+    {
+        auto destination = this->TargetOrTemporary(target);
+        this->Emit(OpCode::LoadConstant, destination, node->_constant);
+        return destination;
+    }
+
+    int BytecodeCompiler::CompileVariableExpression(BoundVariableExpression* node, int target)
+    {
+        if(this->IsLocal(node->_variable.get()))
+        {
+            auto source = this->LocalRegister(node->_variable.get());
+            if(target == -1 || target == source)
+            {
+                /* Locals already live in a register so no code is needed */
+                return source;
+            }
+
+            this->Emit(OpCode::Move, target, source);
+            return target;
+        }
+
+        auto destination = this->TargetOrTemporary(target);
+        this->Emit(OpCode::LoadGlobal, destination, this->GlobalIndex(node->_variable.get()));
+        return destination;
+    }
+
+    int BytecodeCompiler::CompileAssignmentExpression(BoundAssignmentExpression* node, int target)
+    {
+        if(this->IsLocal(node->_variable.get()))
+        {
+            auto variableRegister = this->LocalRegister(node->_variable.get());
+            (void)this->CompileExpression(node->_expression.get(), variableRegister);
+
+            if(target != -1 && target != variableRegister)
+            {
+                this->Emit(OpCode::Move, target, variableRegister);
+                return target;
+            }
+
+            return variableRegister;
+        }
+
+        auto value = this->CompileExpression(node->_expression.get(), target);
+        this->Emit(OpCode::StoreGlobal, this->GlobalIndex(node->_variable.get()), value);
+        return value;
+    }
+
+    int BytecodeCompiler::CompileUnaryExpression(BoundUnaryExpression* node, int target)
+    {
+        auto operand = this->CompileExpression(node->_operand.get(), -1);
+
+        switch(node->_op->_kind)
+        {
+            case BoundNodeKind::Identity:
+            {
+                if(target == -1 || target == operand)
+                {
+                    return operand;
+                }
+
+                this->Emit(OpCode::Move, target, operand);
+                return target;
+            }
+            case BoundNodeKind::Negation:
+            {
+                auto destination = this->TargetOrTemporary(target);
+                this->Emit(OpCode::Negate, destination, operand);
+                return destination;
+            }
+            case BoundNodeKind::LogicalNegation:
+            {
+                auto destination = this->TargetOrTemporary(target);
+                this->Emit(OpCode::LogicalNot, destination, operand);
+                return destination;
+            }
+            default:
+                throw std::logic_error("BytecodeCompiler: Unexpected unary operator " + trylang::__boundNodeStringMap[node->_op->_kind]);
+        }
+    }
+
+    int BytecodeCompiler::CompileBinaryExpression(BoundBinaryExpression* node, int target)
+    {
+        auto left = this->CompileExpression(node->_left.get(), -1);
+        if(left < _firstTemporary && ContainsAssignment(node->_right.get()))
+        {
+            /* The right operand reassigns a variable so the value of the left operand has to be copied before it changes */
+            auto copy = this->AllocateRegister();
+            this->Emit(OpCode::Move, copy, left);
+            left = copy;
+        }
+
+        auto right = this->CompileExpression(node->_right.get(), -1);
+        auto destination = this->TargetOrTemporary(target);
+
+        /* The operand types are already resolved by the Binder so the instruction is picked here once */
+        const char* operandType = node->_left->Type();
+        bool isString = std::strcmp(operandType, Types::STRING->Name()) == 0;
+        bool isBool = std::strcmp(operandType, Types::BOOL->Name()) == 0;
+
+        OpCode op;
+        switch(node->_op->_kind)
+        {
+            case BoundNodeKind::Addition: op = OpCode::AddInt; break; /* String additions are bound to BoundConcatExpression */
+            case BoundNodeKind::Subtraction: op = OpCode::SubtractInt; break;
+            case BoundNodeKind::Multiplication: op = OpCode::MultiplyInt; break;
+            case BoundNodeKind::Division: op = OpCode::DivideInt; break;
+            case BoundNodeKind::LogicalEquality:
+                op = isString ? OpCode::EqualsString : (isBool ? OpCode::EqualsBool : OpCode::EqualsInt);
+                break;
+            case BoundNodeKind::LogicalNotEquality:
+                op = isString ? OpCode::NotEqualsString : (isBool ? OpCode::NotEqualsBool : OpCode::NotEqualsInt);
+                break;
+            case BoundNodeKind::Less: op = OpCode::Less; break;
+            case BoundNodeKind::LessEquals: op = OpCode::LessEquals; break;
+            case BoundNodeKind::Greater: op = OpCode::Greater; break;
+            case BoundNodeKind::GreaterEquals: op = OpCode::GreaterEquals; break;
+            default:
+                throw std::logic_error("BytecodeCompiler: Unexpected binary operator " + trylang::__boundNodeStringMap[node->_op->_kind]);
+        }
+
+        this->Emit(op, destination, left, right);
+        return destination;
+    }
+
+    int BytecodeCompiler::CompileShortCircuitExpression(BoundShortCircuitExpression* node, int target)
+    {
+        /* A temporary holds the result, target may be a variable which is still read by _right */
+        auto result = this->AllocateRegister();
+        (void)this->CompileExpression(node->_left.get(), result);
+
+        auto jump = this->Emit(node->_op->_kind == BoundNodeKind::LogicalAnd ? OpCode::JumpIfFalse : OpCode::JumpIfTrue, result);
+        (void)this->CompileExpression(node->_right.get(), result);
+        _function->_code[jump]._b = static_cast<int>(_function->_code.size());
+
+        if(target != -1 && target != result)
+        {
+            this->Emit(OpCode::Move, target, result);
+            return target;
+        }
+
+        return result;
+    }
+
+    int BytecodeCompiler::CompileConcatExpression(BoundConcatExpression* node, int target)
+    {
+        auto firstPart = this->CompileParts(node->_parts);
+        auto destination = this->TargetOrTemporary(target);
+        this->Emit(OpCode::Concat, destination, firstPart, static_cast<int>(node->_parts.size()));
+        return destination;
+    }
+
+    int BytecodeCompiler::CompileParts(const std::vector<std::unique_ptr<BoundExpressionNode>>& parts)
+    {
+        /* Like call arguments the parts go to consecutive registers, so one instruction sees all of them */
+        auto firstPart = _nextRegister;
+        for(auto i = 0; i < parts.size(); i++)
+        {
+            (void)this->AllocateRegister();
+        }
+
+        for(auto i = 0; i < parts.size(); i++)
+        {
+            (void)this->CompileExpression(parts[i].get(), firstPart + i);
+        }
+
+        return firstPart;
+    }
+
+    int BytecodeCompiler::CompileAppendExpression(BoundAppendExpression* node, int target)
+    {
+        auto* variable = node->_variable.get();
+        auto variableRegister = this->IsLocal(variable) ? this->LocalRegister(variable) : -1;
+
+        if(target != -1 && target != variableRegister)
+        {
+            /* target may still share the string from the previous evaluation, which would force a copy */
+            this->Emit(OpCode::Clear, target);
+        }
+
+        this->CompileAppendParts(node);
+
+        if(variableRegister == -1)
+        {
+            auto destination = this->TargetOrTemporary(target);
+            this->Emit(OpCode::LoadGlobal, destination, this->GlobalIndex(variable));
+            return destination;
+        }
+
+        if(target != -1 && target != variableRegister)
+        {
+            this->Emit(OpCode::Move, target, variableRegister);
+            return target;
+        }
+
+        return variableRegister;
+    }
+
+    void BytecodeCompiler::CompileAppendParts(BoundAppendExpression* node)
+    {
+        auto* variable = node->_variable.get();
+        for(const auto& part: node->_parts)
+        {
+            auto value = this->CompileExpression(part.get(), -1);
+            if(this->IsLocal(variable))
+            {
+                this->Emit(OpCode::AppendString, this->LocalRegister(variable), value);
+            }
+            else
+            {
+                this->Emit(OpCode::AppendGlobal, this->GlobalIndex(variable), value);
+            }
+        }
+    }
+
+    int BytecodeCompiler::CompileCallExpression(BoundCallExpression* node, int target)
+    {
+        if(node->_function->_name == BUILT_IN_FUNCTIONS::MAP.at("input")->_name)
+        {
+            auto destination = this->TargetOrTemporary(target);
+            this->Emit(OpCode::Input, destination);
+            return destination;
+        }
+
+        if(node->_function->_name == BUILT_IN_FUNCTIONS::MAP.at("lines")->_name)
+        {
+            auto destination = this->TargetOrTemporary(target);
+            this->Emit(OpCode::Lines, destination);
+            return destination;
+        }
+
+        if(node->_streamed)
+        {
+            auto* message = static_cast<BoundConcatExpression*>(node->_arguments[0].get());
+            auto firstPart = this->CompileParts(message->_parts);
+            auto destination = this->TargetOrTemporary(target);
+            this->Emit(OpCode::PrintParts, destination, firstPart, static_cast<int>(message->_parts.size()));
+            return destination;
+        }
+
+        if(node->_function->_name == BUILT_IN_FUNCTIONS::MAP.at("print")->_name)
+        {
+            auto message = this->CompileExpression(node->_arguments[0].get(), -1);
+            auto destination = this->TargetOrTemporary(target);
+            this->Emit(OpCode::Print, destination, message);
+            return destination;
+        }
+
+        if(node->_function->_native != nullptr)
+        {
+            auto firstArgument = this->CompileArguments(node);
+            auto destination = this->TargetOrTemporary(target);
+            this->Emit(OpCode::CallNative, destination, this->NativeIndex(node->_function->_native), firstArgument);
+            return destination;
+        }
+
+        auto it = _functionIndices.find(node->_function->_name);
+        if(it == _functionIndices.end())
+        {
+            throw std::logic_error("Unexpected function " + node->_function->_name); /* Logically this throw may never occur */
+        }
+
+        auto firstArgument = this->CompileArguments(node);
+        auto destination = this->TargetOrTemporary(target);
+        this->Emit(OpCode::Call, destination, it->second, firstArgument);
+        return destination;
+    }
+
+    int BytecodeCompiler::CompileArguments(BoundCallExpression* node)
+    {
+        /* The arguments are placed in consecutive registers which become the parameters of the callee frame */
+        auto firstArgument = _nextRegister;
+        for(auto i = 0; i < node->_arguments.size(); i++)
+        {
+            (void)this->AllocateRegister();
+        }
+
+        for(auto i = 0; i < node->_arguments.size(); i++)
+        {
+            (void)this->CompileExpression(node->_arguments[i].get(), firstArgument + i);
+        }
+
+        return firstArgument;
+    }
+
+    int BytecodeCompiler::CompileConversionExpression(BoundConversionExpression* node, int target)
+    {
+        auto value = this->CompileExpression(node->_expression.get(), -1);
+        auto destination = this->TargetOrTemporary(target);
+
+        if(std::strcmp(node->_toType, Types::BOOL->Name()) == 0)
+        {
+            this->Emit(OpCode::ToBool, destination, value);
+        }
+        else if(std::strcmp(node->_toType, Types::INT->Name()) == 0)
+        {
+            this->Emit(OpCode::ToInt, destination, value);
+        }
+        else if(std::strcmp(node->_toType, Types::STRING->Name()) == 0)
+        {
+            this->Emit(OpCode::ToString, destination, value);
+        }
+        else
+        {
+            throw std::logic_error("Unexpected Type " + std::string(node->_toType));
+        }
+
+        return destination;
+    }
+
+    int BytecodeCompiler::Emit(OpCode op, int a, int b, int c)
+    {
+        _function->_code.push_back(Instruction{op, a, b, c});
+        return static_cast<int>(_function->_code.size()) - 1;
+    }
+
+    void BytecodeCompiler::EmitJump(OpCode op, int a, int target)
+    {
+        auto index = this->Emit(op, a);
+        _pendingJumps.emplace_back(index, target);
+    }
+
+    int BytecodeCompiler::AllocateRegister()
+    {
+        auto allocated = _nextRegister++;
+        if(_nextRegister > _function->_registerCount)
+        {
+            _function->_registerCount = _nextRegister;
+        }
+
+        return allocated;
+    }
+
+    int BytecodeCompiler::TargetOrTemporary(int target)
+    {
+        return target == -1 ? this->AllocateRegister() : target;
+    }
+
+    int BytecodeCompiler::NativeIndex(NativeFunction native)
+    {
+        auto& natives = _program->_natives;
+        auto found = std::find(natives.begin(), natives.end(), native);
+        if(found != natives.end())
+        {
+            return static_cast<int>(found - natives.begin());
+        }
+
+        natives.push_back(native);
+        return static_cast<int>(natives.size()) - 1;
+    }
+
+    int BytecodeCompiler::GlobalIndex(VariableSymbol* variable)
+    {
+        return static_cast<GlobalVariableSymbol*>(variable)->_index;
+    }
+
+    bool BytecodeCompiler::IsLocal(VariableSymbol* variable)
+    {
+        return variable->Kind() != SymbolKind::GlobalVariable;
+    }
+
+    int BytecodeCompiler::LocalRegister(VariableSymbol* variable)
+    {
+        return static_cast<LocalVariableSymbol*>(variable)->_slot;
+    }
+
+    bool BytecodeCompiler::ContainsAssignment(BoundNode* node)
+    {
+        if(node == nullptr)
+        {
+            return false;
+        }
+
+        /* AppendString changes the register of its variable in place */
+        if(node->Kind() == BoundNodeKind::AssignmentExpression || node->Kind() == BoundNodeKind::AppendExpression)
+        {
+            return true;
+        }
+
+        for(auto* child: node->GetChildren())
+        {
+            if(ContainsAssignment(child))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+}
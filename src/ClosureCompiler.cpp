@@ -0,0 +1,703 @@
+#include <codeanalysis/closure/ClosureCompiler.hpp>
+#include <codeanalysis/binder/utils/BoundExpressionNode.hpp>
+#include <codeanalysis/binder/utils/BoundNodeKind.hpp>
+#include <codeanalysis/binder/utils/BoundProgram.hpp>
+#include <codeanalysis/utils/StringTable.hpp>
+#include <codeanalysis/output/Output.hpp>
+#include <codeanalysis/input/Input.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <pthread.h>
+#include <stdexcept>
+#include <string>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace trylang
+{
+    namespace
+    {
+        constexpr std::size_t STACK_PER_CALL = 4096;        /* A plain call takes under 1 KB of a debug build */
+        constexpr std::size_t STACK_RESERVE = 1 << 20;      /* The main body, builtins and the deepest expressions */
+        constexpr std::size_t STACK_MARGIN = 256 << 10;     /* Kept free below _stackLimit to report the failure */
+        constexpr std::size_t STACK_MAX_SIZE = 64ull << 30; /* Only address space, pages are used as the calls nest */
+
+        /* The operands are evaluated left to right before op is applied, exactly like the Evaluator does */
+        template<typename Operand, typename Operation>
+        ExpressionClosure MakeBinary(ExpressionClosure left, ExpressionClosure right, Operation op)
+        {
+            return [left = std::move(left), right = std::move(right), op]() -> Value
+            {
+                auto leftValue = left();
+                auto rightValue = right();
+                return op(leftValue.template As<Operand>(), rightValue.template As<Operand>());
+            };
+        }
+
+        template<typename Visitor>
+        ExpressionClosure MakeConversion(ExpressionClosure operand)
+        {
+            return [operand = std::move(operand)]() -> Value
+            {
+                auto value = operand();
+                return value.Visit(Visitor{});
+            };
+        }
+    }
+
+    Value ClosureRuntime::Execute(const ClosureFunction& function)
+    {
+        const auto* current = &function;
+
+        while(true)
+        {
+            const auto* body = current->_body.data();
+            const auto count = static_cast<int>(current->_body.size());
+
+            auto index = 0;
+            while(index >= 0 && index < count)
+            {
+                index = body[index]();
+            }
+
+            if(_tailCallee == nullptr)
+            {
+                return _lastValue;
+            }
+
+            current = _tailCallee;
+            _tailCallee = nullptr;
+        }
+    }
+
+    Value ClosureProgram::Run()
+    {
+        auto page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+        auto size = std::min(_runtime._maxCallDepth, STACK_MAX_SIZE / STACK_PER_CALL) * STACK_PER_CALL + STACK_RESERVE;
+        size = (size + page - 1) / page * page;
+
+        auto* stack = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_STACK, -1, 0);
+        if(stack == MAP_FAILED)
+        {
+            throw std::runtime_error("Not able to allocate the stack of the closure engine: " + std::string(std::strerror(errno)));
+        }
+        mprotect(stack, page, PROT_NONE);
+        _runtime._stackLimit = reinterpret_cast<std::uintptr_t>(stack) + page + STACK_MARGIN;
+
+        struct Job
+        {
+            ClosureProgram* _program;
+            Value _result;
+            std::exception_ptr _error;
+        } job{this, {}, nullptr};
+
+        pthread_attr_t attributes;
+        pthread_attr_init(&attributes);
+        pthread_attr_setstack(&attributes, stack, size);
+
+        pthread_t thread;
+        auto error = pthread_create(&thread, &attributes, [](void* argument) -> void*
+        {
+            auto* job = static_cast<Job*>(argument);
+            try
+            {
+                job->_result = job->_program->_runtime.Execute(job->_program->_main);
+            }
+            catch(...)
+            {
+                job->_error = std::current_exception();
+            }
+            return nullptr;
+        }, &job);
+        pthread_attr_destroy(&attributes);
+
+        if(error == 0)
+        {
+            pthread_join(thread, nullptr);
+        }
+        munmap(stack, size);
+
+        if(error != 0)
+        {
+            throw std::runtime_error("Not able to start the closure engine: " + std::string(std::strerror(error)));
+        }
+        if(job._error)
+        {
+            std::rethrow_exception(job._error);
+        }
+        return job._result;
+    }
+
+    std::unique_ptr<ClosureProgram> ClosureCompiler::Compile(BoundProgram* program, std::size_t maxCallDepth)
+    {
+        auto closureProgram = std::make_unique<ClosureProgram>();
+        closureProgram->_runtime._maxCallDepth = maxCallDepth;
+        closureProgram->_runtime._globals.resize(program->_globalCount);
+
+        ClosureCompiler compiler;
+        compiler._program = closureProgram.get();
+        compiler._runtime = &closureProgram->_runtime;
+
+        /* Every function gets its entry before any body is compiled, so calls can capture their callee */
+        for(const auto& function: program->_functionsInfoAndBody)
+        {
+            closureProgram->_functions[function.second.first.get()]._frameSize = function.second.first->_frameSize;
+        }
+
+        for(const auto& function: program->_functionsInfoAndBody)
+        {
+            compiler.CompileFunction(closureProgram->_functions.at(function.second.first.get()), function.second.second.get());
+        }
+
+        compiler.CompileFunction(closureProgram->_main, program->_statement.get());
+
+        return closureProgram;
+    }
+
+    void ClosureCompiler::CompileFunction(ClosureFunction& function, BoundBlockStatement* body)
+    {
+        function._body.reserve(body->_statements.size());
+        for(auto i = 0; i < body->_statements.size(); i++)
+        {
+            function._body.emplace_back(this->CompileStatement(body->_statements[i].get(), i + 1));
+        }
+    }
+
+    StatementClosure ClosureCompiler::CompileStatement(BoundStatementNode* node, int next)
+    {
+        auto* runtime = _runtime;
+
+        switch(node->Kind())
+        {
+            case BoundNodeKind::VariableDeclarationStatement:
+                return this->CompileVariableDeclaration(static_cast<BoundVariableDeclaration*>(node), next);
+            case BoundNodeKind::ExpressionStatement:
+            {
+                auto expression = this->CompileExpression(static_cast<BoundExpressionStatement*>(node)->_expression.get());
+                return [runtime, expression = std::move(expression), next]()
+                {
+                    runtime->_lastValue = Value(); /* Same as Evaluator::EvaluateExpressionStatement */
+                    runtime->_lastValue = expression();
+                    return next;
+                };
+            }
+            case BoundNodeKind::GotoStatement:
+            {
+                auto target = static_cast<BoundGotoStatement*>(node)->_target;
+                return [target]() { return target; };
+            }
+            case BoundNodeKind::ConditionalGotoStatement:
+                return this->CompileConditionalGotoStatement(static_cast<BoundConditionalGotoStatement*>(node), next);
+            case BoundNodeKind::LabelStatement:
+                return [next]() { return next; };
+            case BoundNodeKind::ReturnStatement:
+                return this->CompileReturnStatement(static_cast<BoundReturnStatement*>(node));
+            default:
+                throw std::logic_error("ClosureCompiler: Unexpected node " + trylang::__boundNodeStringMap[node->Kind()]);
+        }
+    }
+
+    StatementClosure ClosureCompiler::CompileVariableDeclaration(BoundVariableDeclaration* node, int next)
+    {
+        auto* runtime = _runtime;
+        auto value = this->CompileExpression(node->_expression.get());
+
+        if(node->_variable->Kind() == SymbolKind::GlobalVariable)
+        {
+            auto index = static_cast<GlobalVariableSymbol*>(node->_variable.get())->_index;
+            return [runtime, value = std::move(value), index, next]()
+            {
+                runtime->_lastValue = value();
+                runtime->_globals[index] = runtime->_lastValue;
+                return next;
+            };
+        }
+
+        auto slot = static_cast<LocalVariableSymbol*>(node->_variable.get())->_slot;
+        return [runtime, value = std::move(value), slot, next]()
+        {
+            runtime->_lastValue = value();
+            runtime->_frame[slot] = runtime->_lastValue;
+            return next;
+        };
+    }
+
+    StatementClosure ClosureCompiler::CompileConditionalGotoStatement(BoundConditionalGotoStatement* node, int next)
+    {
+        auto condition = this->CompileExpression(node->_condition.get());
+        auto target = node->_target;
+
+        if(node->_jumpIfFalse)
+        {
+            return [condition = std::move(condition), target, next]()
+            {
+                return condition().AsBool() ? next : target;
+            };
+        }
+
+        return [condition = std::move(condition), target, next]()
+        {
+            return condition().AsBool() ? target : next;
+        };
+    }
+
+    StatementClosure ClosureCompiler::CompileReturnStatement(BoundReturnStatement* node)
+    {
+        auto* runtime = _runtime;
+
+        if(node->_expression == nullptr)
+        {
+            return [runtime]()
+            {
+                runtime->_lastValue = 0; /* Default return value in case of "return;" */
+                return -1;
+            };
+        }
+
+        if(node->_isTailCall)
+        {
+            return this->CompileTailCall(static_cast<BoundCallExpression*>(node->_expression.get()));
+        }
+
+        auto expression = this->CompileExpression(node->_expression.get());
+        return [runtime, expression = std::move(expression)]()
+        {
+            runtime->_lastValue = expression();
+            return -1;
+        };
+    }
+
+    ExpressionClosure ClosureCompiler::CompileExpression(BoundExpressionNode* node)
+    {
+        switch(node->Kind())
+        {
+            case BoundNodeKind::LiteralExpression:
+                return this->CompileLiteralExpression(static_cast<BoundLiteralExpression*>(node));
+            case BoundNodeKind::VariableExpression:
+                return this->CompileVariableExpression(static_cast<BoundVariableExpression*>(node));
+            case BoundNodeKind::AssignmentExpression:
+                return this->CompileAssignmentExpression(static_cast<BoundAssignmentExpression*>(node));
+            case BoundNodeKind::UnaryExpression:
+                return this->CompileUnaryExpression(static_cast<BoundUnaryExpression*>(node));
+            case BoundNodeKind::BinaryExpression:
+                return this->CompileBinaryExpression(static_cast<BoundBinaryExpression*>(node));
+            case BoundNodeKind::ShortCircuitExpression:
+                return this->CompileShortCircuitExpression(static_cast<BoundShortCircuitExpression*>(node));
+            case BoundNodeKind::AppendExpression:
+                return this->CompileAppendExpression(static_cast<BoundAppendExpression*>(node));
+            case BoundNodeKind::ConcatExpression:
+                return this->CompileConcatExpression(static_cast<BoundConcatExpression*>(node));
+            case BoundNodeKind::CallExpression:
+                return this->CompileCallExpression(static_cast<BoundCallExpression*>(node));
+            case BoundNodeKind::ConversionExpression:
+                return this->CompileConversionExpression(static_cast<BoundConversionExpression*>(node));
+            default:
+                throw std::logic_error("ClosureCompiler: Unexpected node " + trylang::__boundNodeStringMap[node->Kind()]);
+        }
+    }
+
+    ExpressionClosure ClosureCompiler::CompileLiteralExpression(BoundLiteralExpression* node)
+    {
+        return [value = node->_value]() { return value; };
+    }
+
+    ExpressionClosure ClosureCompiler::CompileVariableExpression(BoundVariableExpression* node)
+    {
+        auto* runtime = _runtime;
+
+        if(node->_variable->Kind() == SymbolKind::GlobalVariable)
+        {
+            auto index = static_cast<GlobalVariableSymbol*>(node->_variable.get())->_index;
+            return [runtime, index]() { return runtime->_globals[index]; };
+        }
+
+        auto slot = static_cast<LocalVariableSymbol*>(node->_variable.get())->_slot;
+        return [runtime, slot]() { return runtime->_frame[slot]; };
+    }
+
+    ExpressionClosure ClosureCompiler::CompileAssignmentExpression(BoundAssignmentExpression* node)
+    {
+        auto* runtime = _runtime;
+        auto value = this->CompileExpression(node->_expression.get());
+
+        if(node->_variable->Kind() == SymbolKind::GlobalVariable)
+        {
+            auto index = static_cast<GlobalVariableSymbol*>(node->_variable.get())->_index;
+            return [runtime, value = std::move(value), index]()
+            {
+                auto result = value();
+                runtime->_globals[index] = result;
+                return result;
+            };
+        }
+
+        auto slot = static_cast<LocalVariableSymbol*>(node->_variable.get())->_slot;
+        return [runtime, value = std::move(value), slot]()
+        {
+            auto result = value();
+            runtime->_frame[slot] = result;
+            return result;
+        };
+    }
+
+    ExpressionClosure ClosureCompiler::CompileUnaryExpression(BoundUnaryExpression* node)
+    {
+        auto operand = this->CompileExpression(node->_operand.get());
+
+        switch(node->_op->_kind)
+        {
+            case BoundNodeKind::Identity:
+                return operand;
+            case BoundNodeKind::Negation:
+                return [operand = std::move(operand)]() -> Value { return -operand().AsInt(); };
+            case BoundNodeKind::LogicalNegation:
+                return [operand = std::move(operand)]() -> Value { return !operand().AsBool(); };
+            default:
+                throw std::logic_error("Unexpected unary operator " + trylang::__boundNodeStringMap[node->_op->_kind]);
+        }
+    }
+
+    ExpressionClosure ClosureCompiler::CompileBinaryExpression(BoundBinaryExpression* node)
+    {
+        auto left = this->CompileExpression(node->_left.get());
+        auto right = this->CompileExpression(node->_right.get());
+
+        /* Both operands always have the same type, the Binder has no mixed binary operator */
+        const char* type = node->_op->_leftOperandType;
+        bool isInt = std::strcmp(type, Types::INT->Name()) == 0;
+        bool isBool = std::strcmp(type, Types::BOOL->Name()) == 0;
+
+        switch(node->_op->_kind)
+        {
+            case BoundNodeKind::Addition:
+                return MakeBinary<int>(std::move(left), std::move(right), std::plus<int>{}); /* String additions are bound to BoundConcatExpression */
+            case BoundNodeKind::Subtraction:
+                return MakeBinary<int>(std::move(left), std::move(right), std::minus<int>{});
+            case BoundNodeKind::Multiplication:
+                return MakeBinary<int>(std::move(left), std::move(right), std::multiplies<int>{});
+            case BoundNodeKind::Division:
+                return MakeBinary<int>(std::move(left), std::move(right), std::divides<int>{});
+            case BoundNodeKind::LogicalEquality:
+                if(isInt)
+                {
+                    return MakeBinary<int>(std::move(left), std::move(right), std::equal_to<int>{});
+                }
+                if(isBool)
+                {
+                    return MakeBinary<bool>(std::move(left), std::move(right), std::equal_to<bool>{});
+                }
+                return [left = std::move(left), right = std::move(right)]() -> Value
+                {
+                    auto leftValue = left();
+                    auto rightValue = right();
+                    return Value::StringEquals(leftValue, rightValue);
+                };
+            case BoundNodeKind::LogicalNotEquality:
+                if(isInt)
+                {
+                    return MakeBinary<int>(std::move(left), std::move(right), std::not_equal_to<int>{});
+                }
+                if(isBool)
+                {
+                    return MakeBinary<bool>(std::move(left), std::move(right), std::not_equal_to<bool>{});
+                }
+                return [left = std::move(left), right = std::move(right)]() -> Value
+                {
+                    auto leftValue = left();
+                    auto rightValue = right();
+                    return !Value::StringEquals(leftValue, rightValue);
+                };
+            case BoundNodeKind::Less:
+                return MakeBinary<int>(std::move(left), std::move(right), std::less<int>{});
+            case BoundNodeKind::LessEquals:
+                return MakeBinary<int>(std::move(left), std::move(right), std::less_equal<int>{});
+            case BoundNodeKind::Greater:
+                return MakeBinary<int>(std::move(left), std::move(right), std::greater<int>{});
+            case BoundNodeKind::GreaterEquals:
+                return MakeBinary<int>(std::move(left), std::move(right), std::greater_equal<int>{});
+            default:
+                throw std::logic_error("Unexpected binary operator " + trylang::__boundNodeStringMap[node->_op->_kind]);
+        }
+    }
+
+    ExpressionClosure ClosureCompiler::CompileShortCircuitExpression(BoundShortCircuitExpression* node)
+    {
+        auto left = this->CompileExpression(node->_left.get());
+        auto right = this->CompileExpression(node->_right.get());
+
+        if(node->_op->_kind == BoundNodeKind::LogicalAnd)
+        {
+            return [left = std::move(left), right = std::move(right)]() -> Value
+            {
+                return left().AsBool() && right().AsBool();
+            };
+        }
+
+        return [left = std::move(left), right = std::move(right)]() -> Value
+        {
+            return left().AsBool() || right().AsBool();
+        };
+    }
+
+    ExpressionClosure ClosureCompiler::CompileConcatExpression(BoundConcatExpression* node)
+    {
+        auto* runtime = _runtime;
+
+        std::vector<ExpressionClosure> parts;
+        for(const auto& part: node->_parts)
+        {
+            parts.emplace_back(this->CompileExpression(part.get()));
+        }
+
+        return [runtime, parts = std::move(parts)]()
+        {
+            /* Same scratch stack as Evaluator::EvaluateConcatExpression */
+            auto base = runtime->_scratch.size();
+            for(const auto& part: parts)
+            {
+                auto value = part();
+                runtime->_scratch.emplace_back(std::move(value));
+            }
+
+            auto result = Value::Concatenate(runtime->_scratch.data() + base, parts.size());
+            runtime->_scratch.resize(base);
+            return result;
+        };
+    }
+
+    ExpressionClosure ClosureCompiler::CompileAppendExpression(BoundAppendExpression* node)
+    {
+        auto* runtime = _runtime;
+
+        std::vector<ExpressionClosure> parts;
+        for(const auto& part: node->_parts)
+        {
+            parts.emplace_back(this->CompileExpression(part.get()));
+        }
+
+        if(node->_variable->Kind() == SymbolKind::GlobalVariable)
+        {
+            auto index = static_cast<GlobalVariableSymbol*>(node->_variable.get())->_index;
+            return [runtime, index, parts = std::move(parts)]()
+            {
+                for(const auto& part: parts)
+                {
+                    auto value = part();
+                    runtime->_globals[index].Append(value);
+                }
+                return runtime->_globals[index];
+            };
+        }
+
+        auto slot = static_cast<LocalVariableSymbol*>(node->_variable.get())->_slot;
+        return [runtime, slot, parts = std::move(parts)]()
+        {
+            for(const auto& part: parts)
+            {
+                auto value = part();
+                runtime->_frame[slot].Append(value);
+            }
+            return runtime->_frame[slot];
+        };
+    }
+
+    ExpressionClosure ClosureCompiler::CompileCallExpression(BoundCallExpression* node)
+    {
+        auto* runtime = _runtime;
+        auto* function = node->_function.get();
+
+        auto arguments = this->CompileArguments(node);
+
+        if(function->_body == nullptr && function->_name == BUILT_IN_FUNCTIONS::MAP.at("input")->_name)
+        {
+            return []() -> Value
+            {
+                return StringTable::Instance().InternInput(std::string(Input::Instance().NextLine()));
+            };
+        }
+
+        if(function->_body == nullptr && function->_name == BUILT_IN_FUNCTIONS::MAP.at("lines")->_name)
+        {
+            return []() -> Value
+            {
+                return Input::Instance().HasLine();
+            };
+        }
+
+        if(node->_streamed)
+        {
+            std::vector<ExpressionClosure> parts;
+            for(const auto& part: static_cast<BoundConcatExpression*>(node->_arguments[0].get())->_parts)
+            {
+                parts.emplace_back(this->CompileExpression(part.get()));
+            }
+
+            return [parts = std::move(parts)]() -> Value
+            {
+                auto& output = Output::Instance();
+                std::size_t length = 0;
+                for(const auto& part: parts)
+                {
+                    length += output.WriteValue(part());
+                }
+                output.EndLine();
+                return static_cast<int>(length);
+            };
+        }
+
+        if(function->_body == nullptr && function->_name == BUILT_IN_FUNCTIONS::MAP.at("print")->_name)
+        {
+            return [text = std::move(arguments[0])]() -> Value
+            {
+                auto value = text();
+                const auto& message = value.AsString();
+                Output::Instance().WriteLine(message);
+                return static_cast<int>(message.size());
+            };
+        }
+
+        if(function->_native != nullptr)
+        {
+            return [runtime, native = function->_native, arguments = std::move(arguments)]() -> Value
+            {
+                /* Same argument handling as Evaluator::EvaluateCallExpression */
+                auto base = runtime->_scratch.size();
+                for(const auto& argument: arguments)
+                {
+                    auto value = argument();
+                    runtime->_scratch.emplace_back(std::move(value));
+                }
+
+                auto result = native(runtime->_scratch.data() + base);
+                runtime->_scratch.resize(base);
+                return result;
+            };
+        }
+
+        const ClosureFunction* callee = this->FindFunction(function);
+
+        return [runtime, callee, arguments = std::move(arguments)]()
+        {
+            if(runtime->_frameDepth >= runtime->_maxCallDepth)
+            {
+                throw std::runtime_error("Stack overflow: more than " + std::to_string(runtime->_maxCallDepth) + " nested calls (see --max-call-depth)");
+            }
+
+            /* Deeply nested expressions can use up the stack before the depth limit */
+            char marker;
+            if(reinterpret_cast<std::uintptr_t>(&marker) < runtime->_stackLimit)
+            {
+                throw std::runtime_error("Stack overflow: the closure engine ran out of stack after " + std::to_string(runtime->_frameDepth) + " nested calls");
+            }
+
+            /* Same frame handling as Evaluator::EvaluateCallExpression */
+            if(runtime->_frameDepth == runtime->_frames.size())
+            {
+                runtime->_frames.emplace_back();
+            }
+            auto& frame = runtime->_frames[runtime->_frameDepth++];
+            if(frame.size() < callee->_frameSize)
+            {
+                frame.resize(callee->_frameSize);
+            }
+
+            for(auto i = 0; i < arguments.size(); i++)
+            {
+                frame[i] = arguments[i]();
+            }
+
+            auto* callerFrame = runtime->_frame;
+            runtime->_frame = frame.data();
+
+            auto result = runtime->Execute(*callee);
+
+            runtime->_frame = callerFrame;
+            runtime->_frameDepth--;
+
+            return result;
+        };
+    }
+
+    StatementClosure ClosureCompiler::CompileTailCall(BoundCallExpression* node)
+    {
+        auto* runtime = _runtime;
+        const ClosureFunction* callee = this->FindFunction(node->_function.get());
+        auto arguments = this->CompileArguments(node);
+
+        return [runtime, callee, arguments = std::move(arguments)]()
+        {
+            /* Same frame swap as Evaluator::EvaluateTailCall */
+            if(runtime->_frameDepth == runtime->_frames.size())
+            {
+                runtime->_frames.emplace_back();
+            }
+            auto& next = runtime->_frames[runtime->_frameDepth++];
+            if(next.size() < callee->_frameSize)
+            {
+                next.resize(callee->_frameSize);
+            }
+
+            for(auto i = 0; i < arguments.size(); i++)
+            {
+                next[i] = arguments[i]();
+            }
+
+            runtime->_frameDepth--;
+
+            auto& frame = runtime->_frames[runtime->_frameDepth - 1];
+            frame.swap(next);
+            runtime->_frame = frame.data();
+            runtime->_tailCallee = callee;
+
+            return -1;
+        };
+    }
+
+    std::vector<ExpressionClosure> ClosureCompiler::CompileArguments(BoundCallExpression* node)
+    {
+        std::vector<ExpressionClosure> arguments;
+        for(const auto& argument: node->_arguments)
+        {
+            arguments.emplace_back(this->CompileExpression(argument.get()));
+        }
+
+        return arguments;
+    }
+
+    const ClosureFunction* ClosureCompiler::FindFunction(FunctionSymbol* function)
+    {
+        auto it = _program->_functions.find(function);
+        if(it == _program->_functions.end())
+        {
+            throw std::logic_error("Unexpected function " + function->_name); /* Logically this throw may never occur */
+        }
+
+        return &it->second;
+    }
+
+    ExpressionClosure ClosureCompiler::CompileConversionExpression(BoundConversionExpression* node)
+    {
+        auto operand = this->CompileExpression(node->_expression.get());
+
+        if(std::strcmp(node->_toType, Types::BOOL->Name()) == 0)
+        {
+            return MakeConversion<BoolConvertVisitor>(std::move(operand));
+        }
+
+        if(std::strcmp(node->_toType, Types::INT->Name()) == 0)
+        {
+            return MakeConversion<IntConvertVisitor>(std::move(operand));
+        }
+
+        if(std::strcmp(node->_toType, Types::STRING->Name()) == 0)
+        {
+            return MakeConversion<StringConvertVisitor>(std::move(operand));
+        }
+
+        throw std::logic_error("Unexpected Type " + std::string(node->_toType));
+    }
+}
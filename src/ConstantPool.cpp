@@ -0,0 +1,52 @@
+#include <codeanalysis/binder/utils/ConstantPool.hpp>
+#include <codeanalysis/utils/StringTable.hpp>
+#include <stdexcept>
+
+namespace trylang
+{
+    int ConstantPool::Add(const Value& value)
+    {
+        auto next = static_cast<int>(_values.size());
+
+        switch(value._tag)
+        {
+            case Value::Tag::Int:
+            {
+                auto inserted = _ints.try_emplace(value.AsInt(), next);
+                if(!inserted.second)
+                {
+                    return inserted.first->second;
+                }
+
+                _values.push_back(value);
+                return next;
+            }
+            case Value::Tag::Bool:
+            {
+                auto& index = _bools[value.AsBool() ? 1 : 0];
+                if(index == -1)
+                {
+                    index = next;
+                    _values.push_back(value);
+                }
+
+                return index;
+            }
+            case Value::Tag::String:
+            {
+                auto found = _strings.find(value.AsString());
+                if(found != _strings.end())
+                {
+                    return found->second;
+                }
+
+                /* Pooled strings are interned too, comparing them with other interned strings is a pointer compare */
+                const auto& pooled = _values.emplace_back(StringTable::Instance().Intern(value));
+                _strings.emplace(pooled.AsString(), next);
+                return next;
+            }
+            default:
+                throw std::logic_error("ConstantPool: Unexpected empty literal");
+        }
+    }
+}
@@ -5,154 +5,223 @@
 #include <codeanalysis/binder/utils/BoundExpressionNode.hpp>
 #include <codeanalysis/parser/utils/SyntaxKind.hpp>
 #include <codeanalysis/binder/BoundScope.hpp>
-#include <codeanalysis/evaluator/Environment.hpp>
 #include <codeanalysis/binder/utils/BoundProgram.hpp>
+#include <codeanalysis/utils/StringTable.hpp>
+#include <codeanalysis/output/Output.hpp>
+#include <codeanalysis/input/Input.hpp>
 #include <memory>
 #include <stdexcept>
 #include <variant>
 
 namespace trylang
 {
-    Evaluator::Evaluator(std::unique_ptr<BoundProgram> program)
-        : _program(std::move(program))
+    Evaluator::Evaluator(std::unique_ptr<BoundProgram> program, std::size_t maxCallDepth)
+        : _maxCallDepth(maxCallDepth), _program(std::move(program))
     {
-        _env = std::make_shared<Environment>(nullptr);
+        _globals.resize(_program->_globalCount);
     }
 
-    object_t Evaluator::Evaluate()
+    Value Evaluator::Evaluate()
     {
         return this->EvaluateStatement(_program->_statement.get());
     }
 
-    object_t Evaluator::EvaluateStatement(BoundBlockStatement* body)
+    Value Evaluator::EvaluateStatement(BoundBlockStatement* body)
     {
-
-        std::unordered_map<LabelSymbol, int, LabelSymbolHash> labelToIndex;
-        for(auto i = 0; i < body->_statements.size(); i++)
-        {
-            auto* BLSnode = dynamic_cast<BoundLabelStatement*>(body->_statements.at(i).get());
-            if(BLSnode != nullptr)
-            {
-                labelToIndex[BLSnode->_label] = i + 1;
-            }
-        }
-
-        auto index= 0;
-        while(index < body->_statements.size())
+        /*
+         * body is linked by Lower, so every goto already knows the index it jumps to. After Lower::HoistCalls a call of a
+         * user defined function is always a whole statement: the caller position goes on _returnPoints and this loop
+         * continues with the callee body, so a trylang call never nests a C++ call
+         * */
+        const StatementList* statements = &body->_statements;
+        std::size_t index = 0;
+
+        while(true)
         {
-            if(body->_statements.at(index) == nullptr)
+            if(index == statements->size())
             {
-                /* Some statement are nullptr. This is happened during lowering of while, if, for into gotos */
-                index++;
-                continue;
-            }
-
-            auto* s = body->_statements.at(index).get();
-
-            auto* BVDSnode = dynamic_cast<BoundVariableDeclaration*>(s);
-            if(BVDSnode != nullptr)
-            {
-                this->EvaluateVariableDeclaration(BVDSnode);
-                index++;
-                continue;
-            }
+                /* Falling off the end of a body returns the last value */
+                if(_returnPoints.empty())
+                {
+                    return _lastValue;
+                }
 
-            auto* BESnode = dynamic_cast<BoundExpressionStatement*>(s);
-            if(BESnode != nullptr)
-            {
-                this->EvaluateExpressionStatement(BESnode);
-                index++;
+                this->ReturnFromCall(statements, index);
                 continue;
             }
 
-            auto* BGnode = dynamic_cast<BoundGotoStatement*>(s);
-            if(BGnode != nullptr)
-            {
-                index = labelToIndex[BGnode->_label];
-                continue;
-            }
+            auto* s = (*statements)[index].get();
 
-            auto* BCGnode = dynamic_cast<BoundConditionalGotoStatement*>(s);
-            if(BCGnode != nullptr)
+            switch(s->Kind())
             {
-                auto condition = this->EvaluateExpression(BCGnode->_condition.get());
-                bool condition_result = std::get<bool>(*condition);
-
-                if(condition_result && !BCGnode->_jumpIfFalse || !condition_result && BCGnode->_jumpIfFalse)
-                {
-                    index = labelToIndex[BCGnode->_label];
-                }
-                else
+                case BoundNodeKind::VariableDeclarationStatement:
                 {
+                    auto* BVDnode = static_cast<BoundVariableDeclaration*>(s);
+                    if(IsUserCall(BVDnode->_expression.get()))
+                    {
+                        this->EnterCall(static_cast<BoundCallExpression*>(BVDnode->_expression.get()), statements, index);
+                        break;
+                    }
+
+                    this->EvaluateVariableDeclaration(BVDnode);
                     index++;
+                    break;
                 }
-                continue;
-            }
-
-            auto* BLSnode = dynamic_cast<BoundLabelStatement*>(s);
-            if(BLSnode != nullptr)
-            {
-                if(BLSnode->_label._name == "StartBlockLabel")
+                case BoundNodeKind::ExpressionStatement:
                 {
-                    _env = std::make_shared<Environment>(_env);
+                    auto* BESnode = static_cast<BoundExpressionStatement*>(s);
+                    if(IsUserCall(BESnode->_expression.get()))
+                    {
+                        this->EnterCall(static_cast<BoundCallExpression*>(BESnode->_expression.get()), statements, index);
+                        break;
+                    }
+
+                    this->EvaluateExpressionStatement(BESnode);
+                    index++;
+                    break;
                 }
-                else if(BLSnode->_label._name == "EndBlockLabel")
+                case BoundNodeKind::GotoStatement:
+                    index = static_cast<BoundGotoStatement*>(s)->_target;
+                    break;
+                case BoundNodeKind::ConditionalGotoStatement:
                 {
-                    _env = _env->_parent;
-                }
-                index++;
-                continue;
-            }
+                    auto* BCGnode = static_cast<BoundConditionalGotoStatement*>(s);
+                    Value storage;
+                    bool condition_result = this->EvaluateOperand(BCGnode->_condition.get(), storage).AsBool();
 
-            auto* BRSnode = dynamic_cast<BoundReturnStatement*>(s);
-            if(BRSnode != nullptr)
-            {
-                if(BRSnode->_expression == nullptr)
-                {
-                    _lastValue = 0; /* Default return value in case of "return;" */
+                    index = condition_result != BCGnode->_jumpIfFalse ? BCGnode->_target : index + 1;
+                    break;
                 }
-                else
+                case BoundNodeKind::LabelStatement:
+                    index++;
+                    break;
+                case BoundNodeKind::ReturnStatement:
                 {
-                    _lastValue = this->EvaluateExpression(BRSnode->_expression.get());
+                    auto* BRSnode = static_cast<BoundReturnStatement*>(s);
+                    if(BRSnode->_isTailCall)
+                    {
+                        /* The callee takes over the current frame and the loop continues with its body, nothing is pushed */
+                        auto* function = this->EvaluateTailCall(static_cast<BoundCallExpression*>(BRSnode->_expression.get()));
+                        statements = &function->_body->_statements;
+                        index = 0;
+                        break;
+                    }
+
+                    if(BRSnode->_expression == nullptr)
+                    {
+                        _lastValue = 0; /* Default return value in case of "return;" */
+                    }
+                    else
+                    {
+                        _lastValue = this->EvaluateExpression(BRSnode->_expression.get());
+                    }
+
+                    if(_returnPoints.empty())
+                    {
+                        return _lastValue;
+                    }
+
+                    this->ReturnFromCall(statements, index);
+                    break;
                 }
-
-                return _lastValue;
+                default:
+                    throw std::logic_error("Unexpected node " + trylang::__boundNodeStringMap[s->Kind()]);
             }
+        }
+    }
 
-            throw std::logic_error("Unexpected node " + trylang::__boundNodeStringMap[s->Kind()]);
+    bool Evaluator::IsUserCall(BoundExpressionNode* node)
+    {
+        return node->Kind() == BoundNodeKind::CallExpression && static_cast<BoundCallExpression*>(node)->_function->_body != nullptr;
+    }
+
+    std::vector<Value>& Evaluator::ClaimFrame(FunctionSymbol* function)
+    {
+        /* std::deque never moves its elements, so the claimed frame stays valid while deeper calls grow the pool */
+        if(_frameDepth == _frames.size())
+        {
+            _frames.emplace_back();
+        }
+        auto& frame = _frames[_frameDepth++];
+        if(frame.size() < function->_frameSize)
+        {
+            frame.resize(function->_frameSize);
         }
 
-        return _lastValue;
+        return frame;
     }
 
-    void Evaluator::EvaluateVariableDeclaration(BoundVariableDeclaration *node)
+    void Evaluator::EnterCall(BoundCallExpression* node, const StatementList*& statements, std::size_t& index)
     {
-        auto value = this->EvaluateExpression(node->_expression.get());
-        _lastValue = value;
+        if(_frameDepth >= _maxCallDepth)
+        {
+            throw std::runtime_error("Stack overflow: more than " + std::to_string(_maxCallDepth) + " nested calls (see --max-call-depth)");
+        }
+
+        auto* function = node->_function.get();
+        auto& frame = this->ClaimFrame(function);
 
-        if(node->_variable->Kind() == SymbolKind::GlobalVariable)
+        /* Arguments have no call of a user defined function left, Lower hoisted them */
+        for(auto i = 0 ; i < node->_arguments.size() ; i++)
         {
-            _env->Define(node->_variable->_name, value);
+            frame[i] = this->EvaluateExpression(node->_arguments[i].get());
         }
-        else
+
+        _returnPoints.push_back(ReturnPoint{statements, index});
+        _frame = frame.data();
+
+        statements = &function->_body->_statements;
+        index = 0;
+    }
+
+    void Evaluator::ReturnFromCall(const StatementList*& statements, std::size_t& index)
+    {
+        _frameDepth--;
+        _frame = _frameDepth == 0 ? nullptr : _frames[_frameDepth - 1].data();
+
+        auto returnPoint = _returnPoints.back();
+        _returnPoints.pop_back();
+        statements = returnPoint._statements;
+        index = returnPoint._index;
+
+        /* Finish the statement which made the call, _lastValue holds the returned value */
+        auto* s = (*statements)[index].get();
+        if(s->Kind() == BoundNodeKind::VariableDeclarationStatement)
         {
-            if(_locals.empty())
-            {
-                std::cout << "For : " << node->_variable->_name << "\n";
-                throw std::logic_error("EvaluateVariableDeclaration _locals ie EMPTY");
-            }
+            this->AssignVariable(static_cast<BoundVariableDeclaration*>(s)->_variable.get(), _lastValue);
+        }
+
+        index++;
+    }
 
-            auto& locals = _locals.top();
-            locals.insert({node->_variable->_name, value}); /* Here insert is IMP */
+    void Evaluator::EvaluateVariableDeclaration(BoundVariableDeclaration *node)
+    {
+        _lastValue = this->EvaluateExpression(node->_expression.get());
+        this->AssignVariable(node->_variable.get(), _lastValue);
+    }
+
+    void Evaluator::AssignVariable(VariableSymbol* variable, const Value& value)
+    {
+        this->VariableSlot(variable) = value;
+    }
+
+    Value& Evaluator::VariableSlot(VariableSymbol* variable)
+    {
+        if(variable->Kind() == SymbolKind::GlobalVariable)
+        {
+            return _globals[static_cast<GlobalVariableSymbol*>(variable)->_index];
         }
+
+        return _frame[static_cast<LocalVariableSymbol*>(variable)->_slot];
     }
 
     void Evaluator::EvaluateExpressionStatement(BoundExpressionStatement *node)
     {
+        _lastValue = Value(); /* Do not keep the previous value alive, it may be the string the expression appends to */
         _lastValue = this->EvaluateExpression(node->_expression.get());
     }
 
-    object_t Evaluator::EvaluateExpression(BoundExpressionNode* node)
+    Value Evaluator::EvaluateExpression(BoundExpressionNode* node)
     {
         switch (node->Kind())
         {
@@ -177,88 +246,105 @@ namespace trylang
             case BoundNodeKind::BinaryExpression:
                 return this->EvaluateBinaryExpression(static_cast<BoundBinaryExpression*>(node));
                 break;
+            case BoundNodeKind::ShortCircuitExpression:
+                return this->EvaluateShortCircuitExpression(static_cast<BoundShortCircuitExpression*>(node));
+                break;
+            case BoundNodeKind::AppendExpression:
+                return this->EvaluateAppendExpression(static_cast<BoundAppendExpression*>(node));
+                break;
+            case BoundNodeKind::ConcatExpression:
+                return this->EvaluateConcatExpression(static_cast<BoundConcatExpression*>(node));
+                break;
             default:
                 throw std::logic_error("Unexpected node " + trylang::__boundNodeStringMap[node->Kind()]);
         }
     }
 
-    object_t Evaluator::EvaluateLiteralExpression(BoundLiteralExpression* node)
+    Value Evaluator::EvaluateLiteralExpression(BoundLiteralExpression* node)
     {
-        return *node->_value;
+        return node->_value;
     }
 
-    object_t Evaluator::EvaluateVariableExpression(BoundVariableExpression *node)
+    Value Evaluator::EvaluateVariableExpression(BoundVariableExpression *node)
     {
-        auto value = _env->LookUpVariable(node->_variable->_name);
-        if(node->_variable->Kind() == SymbolKind::GlobalVariable)
-        {   
-            auto value = _env->LookUpVariable(node->_variable->_name);
-            if(value.has_value())
-            {
-                return *value;
-            }
-            else
-            {
-                throw std::logic_error("'" + node->_variable->_name + "' is not present in the current _env.");
-            }
-        }
-        else
+        return this->VariableSlot(node->_variable.get());
+    }
+
+    const Value& Evaluator::EvaluateOperand(BoundExpressionNode* node, Value& storage)
+    {
+        switch(node->Kind())
         {
-            if(_locals.empty())
-            {
-                std::cout << "For : " << node->_variable->_name << "\n";
-                throw std::logic_error("EvaluateVariableExpression _locals is EMPTY");
-            }
-            const auto& locals = _locals.top();
-            return locals.at(node->_variable->_name);
+            case BoundNodeKind::LiteralExpression:
+                return static_cast<BoundLiteralExpression*>(node)->_value;
+            case BoundNodeKind::VariableExpression:
+                return this->VariableSlot(static_cast<BoundVariableExpression*>(node)->_variable.get());
+            default:
+                storage = this->EvaluateExpression(node);
+                return storage;
         }
     }
+
+    bool Evaluator::IsPureOperand(BoundExpressionNode* node)
+    {
+        return node->Kind() == BoundNodeKind::LiteralExpression || node->Kind() == BoundNodeKind::VariableExpression;
+    }
     
-    object_t Evaluator::EvaluateAssignmentExpression(BoundAssignmentExpression* node)
+    Value Evaluator::EvaluateAssignmentExpression(BoundAssignmentExpression* node)
     {
         auto value = this->EvaluateExpression(node->_expression.get());
+        this->AssignVariable(node->_variable.get(), value);
+        return value;
+    }
 
-        if(node->_variable->Kind() == SymbolKind::GlobalVariable)
+    Value Evaluator::EvaluateConcatExpression(BoundConcatExpression* node)
+    {
+        /* Parts are kept on _scratch until the total length is known, a nested concatenation stacks above them */
+        auto base = _scratch.size();
+        for(const auto& part: node->_parts)
         {
-            if(!_env->Assign(node->_variable->_name, value))
-            {
-                throw std::logic_error( node->_variable->_name + " is not present in the current _env");
-            }
+            auto value = this->EvaluateExpression(part.get());
+            _scratch.emplace_back(std::move(value));
         }
-        else
-        {
-            if(_locals.empty())
-            {
-                throw std::logic_error("EvaluateAssignmentExpression _locals ie EMPTY");
-            }
 
-            auto& locals = _locals.top();
-            locals.at(node->_variable->_name) = value;
+        auto result = Value::Concatenate(_scratch.data() + base, node->_parts.size());
+        _scratch.resize(base);
+        return result;
+    }
+
+    Value Evaluator::EvaluateAppendExpression(BoundAppendExpression* node)
+    {
+        auto& target = this->VariableSlot(node->_variable.get());
+
+        for(const auto& part: node->_parts)
+        {
+            Value storage;
+            target.Append(this->EvaluateOperand(part.get(), storage));
         }
 
-        return value;
+        return target;
     }
 
-    object_t Evaluator::EvaluateUnaryExpression(BoundUnaryExpression* node)
+    Value Evaluator::EvaluateUnaryExpression(BoundUnaryExpression* node)
     {
          
-        object_t operand = this->EvaluateExpression(node->_operand.get());
+        Value storage;
+        const Value& operand = this->EvaluateOperand(node->_operand.get(), storage);
         
         if(node->_op->_kind == BoundNodeKind::Identity)
         {
-            int operand_value = std::get<int>(*operand); /* If we are reaching here means operand has "int" */
+            int operand_value = operand.AsInt(); /* If we are reaching here means operand has "int" */
             return operand_value;
         }
 
         if(node->_op->_kind == BoundNodeKind::Negation)
         {
-            int operand_value = std::get<int>(*operand); /* If we are reaching here means operand has "int" */
+            int operand_value = operand.AsInt(); /* If we are reaching here means operand has "int" */
             return -operand_value;
         }
 
         if(node->_op->_kind == BoundNodeKind::LogicalNegation)
         {
-            bool operand_value = std::get<bool>(*operand); /* If we are reaching here means operand has "bool" */
+            bool operand_value = operand.AsBool(); /* If we are reaching here means operand has "bool" */
             return !operand_value;
         }
 
@@ -266,226 +352,134 @@ namespace trylang
         
     }
 
-    object_t Evaluator::EvaluateCallExpression(BoundCallExpression* node)
+    Value Evaluator::EvaluateCallExpression(BoundCallExpression* node)
     {
-        if(node->_function->_name == BUILT_IN_FUNCTIONS::MAP.at("input")->_name)
+        auto* function = node->_function.get();
+
+        if(function->_body == nullptr && function->_name == BUILT_IN_FUNCTIONS::MAP.at("input")->_name)
+        {
+            return StringTable::Instance().InternInput(std::string(Input::Instance().NextLine()));
+        }
+        else if(function->_body == nullptr && function->_name == BUILT_IN_FUNCTIONS::MAP.at("lines")->_name)
         {
-            std::string input;
-            std::getline(std::cin, input);
+            return Input::Instance().HasLine();
+        }
+        else if(node->_streamed)
+        {
+            auto& output = Output::Instance();
+            std::size_t length = 0;
+            for(const auto& part: static_cast<BoundConcatExpression*>(node->_arguments[0].get())->_parts)
+            {
+                Value storage;
+                length += output.WriteValue(this->EvaluateOperand(part.get(), storage));
+            }
+            output.EndLine();
 
-            return input;
+            return static_cast<int>(length);
         }
-        else if(node->_function->_name == BUILT_IN_FUNCTIONS::MAP.at("print")->_name)
+        else if(function->_body == nullptr && function->_name == BUILT_IN_FUNCTIONS::MAP.at("print")->_name)
         {
-            auto evaluated_first_argument_value = this->EvaluateExpression(node->_arguments[0].get());
-            const auto& message = std::get<std::string>(*evaluated_first_argument_value);
-            std::cout << message << "\n";
+            Value storage;
+            const auto& message = this->EvaluateOperand(node->_arguments[0].get(), storage).AsString();
+            Output::Instance().WriteLine(message);
 
             return static_cast<int>(message.size());
         }
-        else
+
+        if(function->_native != nullptr)
         {
-            variable_map_t locals;
-            for(auto i = 0 ; i < node->_arguments.size() ; i++)
+            /* The arguments stay on _scratch for the duration of the call, nested calls stack above them */
+            auto base = _scratch.size();
+            for(const auto& argument: node->_arguments)
             {
-                auto parameter = node->_function->_parameters[i];
-                auto value = this->EvaluateExpression(node->_arguments[i].get());
-                locals[parameter._name] = value;
+                auto value = this->EvaluateExpression(argument.get());
+                _scratch.emplace_back(std::move(value));
             }
 
+            auto result = function->_native(_scratch.data() + base);
+            _scratch.resize(base);
+            return result;
+        }
 
-            _locals.push(locals);
-            // std::cout << " Function name: " << node->_function->_name << "\n";
+        /* Calls of user defined functions are whole statements after Lower::HoistCalls and run by EvaluateStatement */
+        throw std::logic_error("Unexpected call of " + function->_name); /* Logically this throw may never occur */
+    }
 
-            auto it = _program->_functionsInfoAndBody.find(node->_function->_name);
-            if(it == _program->_functionsInfoAndBody.end())
-            {
-                throw std::logic_error("Unexpected function " + node->_function->_name); /* Logically this throw may never occur */
-            }
-            auto result = this->EvaluateStatement(it->second.second.get());
+    FunctionSymbol* Evaluator::EvaluateTailCall(BoundCallExpression* node)
+    {
+        auto* function = node->_function.get();
 
-            _locals.pop();
+        /*
+         * The arguments may still read the parameters of the current frame, so they are evaluated into the frame of the
+         * next depth which is then swapped with the current one. Swapping the vectors keeps both allocations in the pool
+         * */
+        auto& arguments = this->ClaimFrame(function);
 
-            return result;
+        for(auto i = 0 ; i < node->_arguments.size() ; i++)
+        {
+            arguments[i] = this->EvaluateExpression(node->_arguments[i].get());
         }
+
+        _frameDepth--;
+
+        auto& frame = _frames[_frameDepth - 1];
+        frame.swap(arguments);
+        _frame = frame.data();
+
+        return function;
     }
 
-    object_t Evaluator::EvaluateConversionExpression(BoundConversionExpression* node)
+    Value Evaluator::EvaluateConversionExpression(BoundConversionExpression* node)
     {   
-        auto value = this->EvaluateExpression(node->_expression.get());
+        Value storage;
+        const Value& value = this->EvaluateOperand(node->_expression.get(), storage);
         if(std::strcmp(node->_toType, Types::BOOL->Name()) == 0)
         {
             /* It returns bool */
-            return std::visit(BoolConvertVisitor{}, *value);
+            return value.Visit(BoolConvertVisitor{});
         }
 
         if(std::strcmp(node->_toType, Types::INT->Name()) == 0)
         {
             /* It returns int */
-            return std::visit(IntConvertVisitor{}, *value);
+            return value.Visit(IntConvertVisitor{});
         }
 
         if(std::strcmp(node->_toType, Types::STRING->Name()) == 0)
         {
             /* It returns std::string */
-            return std::visit(StringConvertVisitor{}, *value);
+            return value.Visit(StringConvertVisitor{});
         }
 
         throw std::logic_error("Unexpected Type " + std::string(node->_toType));
     }
 
-    object_t Evaluator::EvaluateBinaryExpression(BoundBinaryExpression* node)
+    Value Evaluator::EvaluateBinaryExpression(BoundBinaryExpression* node)
     {
-        /* If we reach here we need to have a "int" or "bool" or "string" */
-        oobject_t left = *(this->EvaluateExpression(node->_left.get()));
-        oobject_t right = *(this->EvaluateExpression(node->_right.get()));
-
-        if(node->_op->_kind == BoundNodeKind::Addition)
-        {
-            if(std::strcmp(node->Type(), Types::INT->Name()) == 0)
-            {
-                int left_value = std::get<int>(left);
-                int right_value = std::get<int>(right);
-
-                return left_value + right_value;
-            }
-
-            if(std::strcmp(node->Type(), Types::STRING->Name()) == 0)
-            {
-                const std::string& left_value = std::get<std::string>(left);
-                const std::string& right_value = std::get<std::string>(right);
-
-                return left_value + right_value;
-            }
-
-        }
-
-        if(node->_op->_kind == BoundNodeKind::Subtraction)
-        {
-            int left_value = std::get<int>(left);
-            int right_value = std::get<int>(right);
-            return left_value - right_value;
-        }
-
-        if(node->_op->_kind == BoundNodeKind::Division)
-        {
-            int left_value = std::get<int>(left);
-            int right_value = std::get<int>(right);
-            return left_value / right_value;
-        }
-
-        if(node->_op->_kind == BoundNodeKind::Multiplication)
-        {
-            int left_value = std::get<int>(left);
-            int right_value = std::get<int>(right);
-            return left_value * right_value;
-        }
-
-        if(node->_op->_kind == BoundNodeKind::LogicalOr)
-        {
-            bool left_value = std::get<bool>(left);
-            bool right_value = std::get<bool>(right);
-            return (left_value || right_value);
-        }
-
-        if(node->_op->_kind == BoundNodeKind::LogicalAnd)
-        {
-            bool left_value = std::get<bool>(left);
-            bool right_value = std::get<bool>(right);
-            return (left_value && right_value);
-        }
-
-        if(node->_op->_kind == BoundNodeKind::LogicalEquality)
-        {
-            /* No need to check for both _right and _left. Checking any one of them would have been also fine */
-            if((std::strcmp(node->_right->Type(), Types::INT->Name()) == 0) &&
-                (std::strcmp(node->_left->Type(), Types::INT->Name()) == 0))
-            {
-                int left_value = std::get<int>(left);
-                int right_value = std::get<int>(right);
-
-                return left_value == right_value;
-            }
-
-            if((std::strcmp(node->_right->Type(), Types::STRING->Name()) == 0) &&
-                (std::strcmp(node->_left->Type(), Types::STRING->Name()) == 0))
-            {
-                const std::string& left_value = std::get<std::string>(left);
-                const std::string& right_value = std::get<std::string>(right);
-
-                return left_value == right_value;
-            }
-
-            if((std::strcmp(node->_right->Type(), Types::BOOL->Name()) == 0) &&
-                (std::strcmp(node->_left->Type(), Types::BOOL->Name()) == 0))
-            {
-                bool left_value = std::get<bool>(left);
-                bool right_value = std::get<bool>(right);
-
-                return left_value == right_value;
-            }
-        }
-
-        if(node->_op->_kind == BoundNodeKind::LogicalNotEquality)
-        {
-
-            /* No need to check for both _right and _left. Checking any one of them would have been also fine */
-            if((std::strcmp(node->_right->Type(), Types::INT->Name()) == 0) &&
-                (std::strcmp(node->_left->Type(), Types::INT->Name()) == 0))
-            {
-                int left_value = std::get<int>(left);
-                int right_value = std::get<int>(right);
-
-                return left_value != right_value;
-            }
-
-            if((std::strcmp(node->_right->Type(), Types::STRING->Name()) == 0) &&
-                (std::strcmp(node->_left->Type(), Types::STRING->Name()) == 0))
-            {
-                const std::string& left_value = std::get<std::string>(left);
-                const std::string& right_value = std::get<std::string>(right);
-
-                return left_value != right_value;
-            }
-
-            if((std::strcmp(node->_right->Type(), Types::BOOL->Name()) == 0) &&
-                (std::strcmp(node->_left->Type(), Types::BOOL->Name()) == 0))
-            {
-                bool left_value = std::get<bool>(left);
-                bool right_value = std::get<bool>(right);
-
-                return left_value != right_value;
-            }
-        }
-
-        if(node->_op->_kind == BoundNodeKind::Less)
-        {
-            int left_value = std::get<int>(left);
-            int right_value = std::get<int>(right);
-            return left_value < right_value;
-        }
-
-        if(node->_op->_kind == BoundNodeKind::LessEquals)
-        {
-            int left_value = std::get<int>(left);
-            int right_value = std::get<int>(right);
-            return left_value <= right_value;
-        }
+        /*
+         *  Operands are evaluated left to right, then the operator resolved by the Binder applies itself to them.
+         *  The left operand is only read in place when evaluating the right one cannot assign the variable it reads
+         * */
+        Value leftStorage;
+        Value rightStorage;
+        const Value& left = IsPureOperand(node->_right.get())
+            ? this->EvaluateOperand(node->_left.get(), leftStorage)
+            : (leftStorage = this->EvaluateExpression(node->_left.get()));
+        const Value& right = this->EvaluateOperand(node->_right.get(), rightStorage);
+
+        return node->_op->Evaluate(left, right);
+    }
 
-        if(node->_op->_kind == BoundNodeKind::Greater)
-        {
-            int left_value = std::get<int>(left);
-            int right_value = std::get<int>(right);
-            return left_value > right_value;
-        }
+    Value Evaluator::EvaluateShortCircuitExpression(BoundShortCircuitExpression* node)
+    {
+        bool left = this->EvaluateExpression(node->_left.get()).AsBool();
 
-        if(node->_op->_kind == BoundNodeKind::GreaterEquals)
+        /* false && ... is false and true || ... is true, the right operand is not evaluated then */
+        if(left != (node->_op->_kind == BoundNodeKind::LogicalAnd))
         {
-            int left_value = std::get<int>(left);
-            int right_value = std::get<int>(right);
-            return left_value >= right_value;
+            return left;
         }
 
-        throw std::logic_error("Unexpected binary operator " + trylang::__boundNodeStringMap[node->_op->_kind]);
+        return this->EvaluateExpression(node->_right.get()).AsBool();
     }
 }
\ No newline at end of file
@@ -7,7 +7,7 @@ namespace trylang
         std::cout << indent;
         std::cout << node->Kind(); /* cout is overloaded for node->Kind() */
 
-        SyntaxToken* data = dynamic_cast<SyntaxToken*>(node);
+        auto* data = dynamic_cast<LiteralExpressionSyntax*>(node);
         if(data != nullptr && data->_value.has_value())
         {
             std::cout << " (";
@@ -29,8 +29,8 @@ namespace trylang
 
     }
 
-    CompilationUnitSyntax::CompilationUnitSyntax(std::vector<std::unique_ptr<StatementSyntax>> statements)
-        : _statements(std::move(statements))
+    CompilationUnitSyntax::CompilationUnitSyntax(std::vector<std::unique_ptr<StatementSyntax>> statements, TokenStream tokens)
+        : _statements(std::move(statements)), _tokens(std::move(tokens))
     {}
 
 
@@ -51,9 +51,9 @@ namespace trylang
     }
 
     BlockStatementSyntax::BlockStatementSyntax(
-            std::unique_ptr<SyntaxToken> openBraceToken,
+            int openBraceToken,
             std::vector<std::unique_ptr<StatementSyntax>> statements ,
-            std::unique_ptr<SyntaxToken> closeBraceToken) : _openBraceToken(std::move(openBraceToken)), _statements(std::move(statements)), _closeBraceToken(std::move(closeBraceToken))
+            int closeBraceToken) : _openBraceToken(openBraceToken), _statements(std::move(statements)), _closeBraceToken(closeBraceToken)
     {}
 
     SyntaxKind BlockStatementSyntax::Kind()
@@ -64,24 +64,21 @@ namespace trylang
     std::vector<SyntaxNode*> BlockStatementSyntax::GetChildren()
     {
         std::vector<SyntaxNode*> children(_statements.size() + 2);
-
-        children.push_back(_openBraceToken.get());
         for(const auto& stmt: _statements)
         {
             children.push_back(stmt.get());
         }
-        children.push_back(_closeBraceToken.get());
 
         return children; // RVO
     }
 
     VariableDeclarationStatementSyntax::VariableDeclarationStatementSyntax(
-            std::unique_ptr<SyntaxToken> keyword,
-            std::unique_ptr<SyntaxToken> identifier,
+            int keyword,
+            int identifier,
             std::unique_ptr<TypeClauseSyntax> typeClause,
-            std::unique_ptr<SyntaxToken> equalsToken,
+            int equalsToken,
             std::unique_ptr<ExpressionSyntax> expression
-        ) : _keyword(std::move(keyword)), _identifier(std::move(identifier)), _typeClause(std::move(typeClause)) ,_equalsToken(std::move(equalsToken)), _expression(std::move(expression))
+        ) : _keyword(keyword), _identifier(identifier), _typeClause(std::move(typeClause)) ,_equalsToken(equalsToken), _expression(std::move(expression))
     {}
 
     SyntaxKind VariableDeclarationStatementSyntax::Kind()
@@ -91,7 +88,7 @@ namespace trylang
 
     std::vector<SyntaxNode*> VariableDeclarationStatementSyntax::GetChildren()
     {
-        return {_keyword.get(), _identifier.get(), _typeClause.get() ,_equalsToken.get(), _expression.get()};
+        return {_typeClause.get() ,_expression.get()};
     }
 
     ExpressionStatementSyntax::ExpressionStatementSyntax(std::unique_ptr<ExpressionSyntax> expression) : _expression(std::move(expression))
@@ -107,8 +104,8 @@ namespace trylang
         return {_expression.get()};
     }
 
-    NameExpressionSyntax::NameExpressionSyntax(std::unique_ptr<SyntaxToken> identifierToken)
-            : _identifierToken(std::move(identifierToken))
+    NameExpressionSyntax::NameExpressionSyntax(int identifierToken)
+            : _identifierToken(identifierToken)
     {}
 
     SyntaxKind NameExpressionSyntax::Kind()
@@ -118,11 +115,11 @@ namespace trylang
 
     std::vector<SyntaxNode*> NameExpressionSyntax::GetChildren()
     {
-        return std::vector<SyntaxNode*>{_identifierToken.get()};
+        return {};
     }
 
-    AssignmentExpressionSyntax::AssignmentExpressionSyntax(std::unique_ptr<SyntaxToken> identifierToken, std::unique_ptr<SyntaxToken> equalsToken, std::unique_ptr<ExpressionSyntax> expression)
-            : _identifierToken(std::move(identifierToken)), _equalsToken(std::move(equalsToken)), _expression(std::move(expression))
+    AssignmentExpressionSyntax::AssignmentExpressionSyntax(int identifierToken, int equalsToken, std::unique_ptr<ExpressionSyntax> expression)
+            : _identifierToken(identifierToken), _equalsToken(equalsToken), _expression(std::move(expression))
     {}
 
     SyntaxKind AssignmentExpressionSyntax::Kind()
@@ -132,17 +129,11 @@ namespace trylang
 
     std::vector<SyntaxNode*> AssignmentExpressionSyntax::GetChildren()
     {
-        return std::vector<SyntaxNode*>{_identifierToken.get(), _equalsToken.get(), _expression.get()};
+        return std::vector<SyntaxNode*>{_expression.get()};
     }
     
-    LiteralExpressionSyntax::LiteralExpressionSyntax(std::unique_ptr<SyntaxToken> literalToken)
-        : _literalToken(std::move(literalToken)) 
-    {
-        _value = _literalToken->_value;
-    }
-
-    LiteralExpressionSyntax::LiteralExpressionSyntax(std::unique_ptr<SyntaxToken> literalToken, const object_t& value)
-        : _literalToken(std::move(literalToken)), _value(value)
+    LiteralExpressionSyntax::LiteralExpressionSyntax(int literalToken, object_t value)
+        : _literalToken(literalToken), _value(std::move(value))
     {}
     
     SyntaxKind LiteralExpressionSyntax::Kind()
@@ -152,11 +143,11 @@ namespace trylang
 
     std::vector<SyntaxNode*> LiteralExpressionSyntax::GetChildren()
     {
-        return std::vector<SyntaxNode*>{_literalToken.get()};
+        return {};
     }
 
-    BinaryExpressionSyntax::BinaryExpressionSyntax(std::unique_ptr<ExpressionSyntax> left, std::unique_ptr<SyntaxToken> operatorToken, std::unique_ptr<ExpressionSyntax> right)
-        : _left(std::move(left)), _operatorToken(std::move(operatorToken)), _right(std::move(right)) {}
+    BinaryExpressionSyntax::BinaryExpressionSyntax(std::unique_ptr<ExpressionSyntax> left, int operatorToken, std::unique_ptr<ExpressionSyntax> right)
+        : _left(std::move(left)), _operatorToken(operatorToken), _right(std::move(right)) {}
 
     SyntaxKind BinaryExpressionSyntax::Kind()
     {
@@ -165,11 +156,11 @@ namespace trylang
 
     std::vector<SyntaxNode*> BinaryExpressionSyntax::GetChildren()
     {
-        return std::vector<SyntaxNode*>{ _left.get(), _operatorToken.get(), _right.get()};
+        return std::vector<SyntaxNode*>{ _left.get(), _right.get()};
     }
 
-    UnaryExpressionSyntax::UnaryExpressionSyntax(std::unique_ptr<SyntaxToken> operatorToken, std::unique_ptr<ExpressionSyntax> operand)
-        : _operatorToken(std::move(operatorToken)), _operand(std::move(operand)) {}
+    UnaryExpressionSyntax::UnaryExpressionSyntax(int operatorToken, std::unique_ptr<ExpressionSyntax> operand)
+        : _operatorToken(operatorToken), _operand(std::move(operand)) {}
 
     SyntaxKind UnaryExpressionSyntax::Kind()
     {
@@ -178,11 +169,11 @@ namespace trylang
 
     std::vector<SyntaxNode*> UnaryExpressionSyntax::GetChildren()
     {
-        return std::vector<SyntaxNode*>{_operatorToken.get(), _operand.get()};
+        return std::vector<SyntaxNode*>{_operand.get()};
     }
 
-    ParenthesizedExpressionSyntax::ParenthesizedExpressionSyntax(std::unique_ptr<SyntaxToken> openParenthesisToken, std::unique_ptr<ExpressionSyntax> expression, std::unique_ptr<SyntaxToken> closeParenthesisToken)
-        : _openParenthesisToken(std::move(openParenthesisToken)), _expression(std::move(expression)), _closeParenthesisToken(std::move(closeParenthesisToken)) {}
+    ParenthesizedExpressionSyntax::ParenthesizedExpressionSyntax(int openParenthesisToken, std::unique_ptr<ExpressionSyntax> expression, int closeParenthesisToken)
+        : _openParenthesisToken(openParenthesisToken), _expression(std::move(expression)), _closeParenthesisToken(closeParenthesisToken) {}
 
     SyntaxKind ParenthesizedExpressionSyntax::Kind()
     {
@@ -191,41 +182,11 @@ namespace trylang
 
     std::vector<SyntaxNode*> ParenthesizedExpressionSyntax::GetChildren()
     {
-        return std::vector<SyntaxNode*>{_openParenthesisToken.get(), _expression.get(), _closeParenthesisToken.get()};
+        return std::vector<SyntaxNode*>{_expression.get()};
     }
 
-    SyntaxToken::SyntaxToken(SyntaxKind kind, int line, std::string&& text, object_t&& value)
-            : _kind(kind), _line(line), _text(std::move(text)), _value(value)
-        {}
-
-    /**********************************************************************************************/
-    SyntaxKind SyntaxToken::Kind()
-    {
-        return _kind;
-    }
-
-    std::vector<SyntaxNode*> SyntaxToken::GetChildren()
-    {
-        return std::vector<SyntaxNode*>{nullptr};
-    }
-    /**********************************************************************************************/
-
-    std::ostream& operator<<(std::ostream& out, const SyntaxToken& token)
-    {
-        out << trylang::__syntaxStringMap[token._kind] << ": '" << token._text << "' ";
-
-        if(token._value.has_value())
-        {
-            std::visit(PrintVisitor{}, *token._value);
-        }
-
-        out << "\n";
-
-        return out;
-    }
-
-    ElseStatementSyntax::ElseStatementSyntax(std::unique_ptr<SyntaxToken> elseKeyword, std::unique_ptr<StatementSyntax> elseStatement)
-        : _elseKeyword(std::move(elseKeyword)), _elseStatement(std::move(elseStatement))
+    ElseStatementSyntax::ElseStatementSyntax(int elseKeyword, std::unique_ptr<StatementSyntax> elseStatement)
+        : _elseKeyword(elseKeyword), _elseStatement(std::move(elseStatement))
     {
 
     }
@@ -237,13 +198,13 @@ namespace trylang
 
     std::vector<SyntaxNode *> ElseStatementSyntax::GetChildren()
     {
-        return std::vector<SyntaxNode *>{_elseKeyword.get(), _elseStatement.get()};
+        return std::vector<SyntaxNode *>{_elseStatement.get()};
     }
 
-    IfStatementSyntax::IfStatementSyntax(std::unique_ptr<SyntaxToken> ifKeyword,
+    IfStatementSyntax::IfStatementSyntax(int ifKeyword,
                                          std::unique_ptr<ExpressionSyntax> condition,
                                          std::unique_ptr<StatementSyntax> thenStatement,
-                                         std::unique_ptr<StatementSyntax> elseClause) : _ifKeyword(std::move(ifKeyword)), _condition(std::move(condition)), _thenStatement(std::move(thenStatement)), _elseClause(std::move(elseClause))
+                                         std::unique_ptr<StatementSyntax> elseClause) : _ifKeyword(ifKeyword), _condition(std::move(condition)), _thenStatement(std::move(thenStatement)), _elseClause(std::move(elseClause))
     {
 
     }
@@ -255,12 +216,12 @@ namespace trylang
 
     std::vector<SyntaxNode *> IfStatementSyntax::GetChildren()
     {
-        return {_ifKeyword.get(), _condition.get(), _thenStatement.get(), _elseClause.get()};
+        return {_condition.get(), _thenStatement.get(), _elseClause.get()};
     }
 
-    WhileStatementSyntax::WhileStatementSyntax(std::unique_ptr<SyntaxToken> whileKeyword,
+    WhileStatementSyntax::WhileStatementSyntax(int whileKeyword,
                                                std::unique_ptr<ExpressionSyntax> condition,
-                                               std::unique_ptr<StatementSyntax> body) : _whileKeyword(std::move(whileKeyword)), _condition(std::move(condition)), _body(std::move(body))
+                                               std::unique_ptr<StatementSyntax> body) : _whileKeyword(whileKeyword), _condition(std::move(condition)), _body(std::move(body))
     {
 
     }
@@ -272,7 +233,7 @@ namespace trylang
 
     std::vector<SyntaxNode *> WhileStatementSyntax::GetChildren()
     {
-        return {_whileKeyword.get(), _condition.get(), _body.get()};
+        return {_condition.get(), _body.get()};
     }
 
     SyntaxKind CallExpressionSyntax::Kind()
@@ -283,29 +244,25 @@ namespace trylang
     std::vector<SyntaxNode *> CallExpressionSyntax::GetChildren()
     {
         std::vector<SyntaxNode*> children(_arguments.size() + 3);
-        children.push_back(_identifier.get());
-        children.push_back(_openParenthesis.get());
 
         for(const auto& argument: _arguments)
         {
             children.push_back(argument.get());
         }
 
-        children.push_back(_closeParenthesis.get());
-
         return children;
     }
 
-    CallExpressionSyntax::CallExpressionSyntax(std::unique_ptr<SyntaxToken> identifier,
-                                               std::unique_ptr<SyntaxToken> openParenthesis,
+    CallExpressionSyntax::CallExpressionSyntax(int identifier,
+                                               int openParenthesis,
                                                std::vector<std::unique_ptr<ExpressionSyntax>> arguments,
-                                               std::unique_ptr<SyntaxToken> closeParenthesis) : _identifier(std::move(identifier)), _openParenthesis(std::move(openParenthesis)), _arguments(std::move(arguments)), _closeParenthesis(std::move(closeParenthesis))
+                                               int closeParenthesis) : _identifier(identifier), _openParenthesis(openParenthesis), _arguments(std::move(arguments)), _closeParenthesis(closeParenthesis)
     {
 
     }
 
-    TypeClauseSyntax::TypeClauseSyntax(std::unique_ptr<SyntaxToken> colonToken,
-                                       std::unique_ptr<SyntaxToken> identifierToken): _colonToken(std::move(colonToken)), _identifierToken(std::move(identifierToken))
+    TypeClauseSyntax::TypeClauseSyntax(int colonToken,
+                                       int identifierToken): _colonToken(colonToken), _identifierToken(identifierToken)
     {
 
     }
@@ -317,11 +274,11 @@ namespace trylang
 
     std::vector<SyntaxNode *> TypeClauseSyntax::GetChildren()
     {
-        return {_colonToken.get(), _identifierToken.get()};
+        return {};
     }
 
-    ParameterSyntax::ParameterSyntax(std::unique_ptr<SyntaxToken> identifier,
-                                     std::unique_ptr<TypeClauseSyntax> type) : _identifier(std::move(identifier)), _type(std::move(type))
+    ParameterSyntax::ParameterSyntax(int identifier,
+                                     std::unique_ptr<TypeClauseSyntax> type) : _identifier(identifier), _type(std::move(type))
     {
 
     }
@@ -333,16 +290,16 @@ namespace trylang
 
     std::vector<SyntaxNode *> ParameterSyntax::GetChildren()
     {
-        return {_identifier.get(), _type.get()};
+        return {_type.get()};
     }
 
-    FunctionDeclarationStatementSyntax::FunctionDeclarationStatementSyntax(std::unique_ptr<SyntaxToken> functionKeyword,
-                                                         std::unique_ptr<SyntaxToken> identifier,
-                                                         std::unique_ptr<SyntaxToken> openParenthesisToken,
+    FunctionDeclarationStatementSyntax::FunctionDeclarationStatementSyntax(int functionKeyword,
+                                                         int identifier,
+                                                         int openParenthesisToken,
                                                          std::vector<std::unique_ptr<ParameterSyntax>> parameters,
-                                                         std::unique_ptr<SyntaxToken> closeParenthesisToken,
+                                                         int closeParenthesisToken,
                                                          std::unique_ptr<TypeClauseSyntax> typeClause,
-                                                         std::unique_ptr<StatementSyntax> body) : _functionKeyword(std::move(functionKeyword)), _identifier(std::move(identifier)), _openParenthesisToken(std::move(openParenthesisToken)), _parameters(std::move(parameters)), _closeParenthesisToken(std::move(closeParenthesisToken)), _typeClause(std::move(typeClause)), _body(std::move(body))
+                                                         std::unique_ptr<StatementSyntax> body) : _functionKeyword(functionKeyword), _identifier(identifier), _openParenthesisToken(openParenthesisToken), _parameters(std::move(parameters)), _closeParenthesisToken(closeParenthesisToken), _typeClause(std::move(typeClause)), _body(std::move(body))
     {
 
     }
@@ -355,21 +312,17 @@ namespace trylang
     std::vector<SyntaxNode *> FunctionDeclarationStatementSyntax::GetChildren()
     {
         std::vector<SyntaxNode*> children(5 + _parameters.size());
-        children.push_back(_functionKeyword.get());
-        children.push_back(_identifier.get());
-        children.push_back(_openParenthesisToken.get());
         for(const auto& param: _parameters)
         {
             children.push_back(param.get());
         }
-        children.push_back(_closeParenthesisToken.get());
         children.push_back(_typeClause.get());
         children.push_back(_body.get());
 
         return children; // RVO
     }
 
-    BreakStatementSyntax::BreakStatementSyntax(std::unique_ptr<SyntaxToken> breakKeyword): _breakKeyword(std::move(breakKeyword))
+    BreakStatementSyntax::BreakStatementSyntax(int breakKeyword): _breakKeyword(breakKeyword)
     {
 
     }
@@ -381,10 +334,10 @@ namespace trylang
 
     std::vector<SyntaxNode *> BreakStatementSyntax::GetChildren()
     {
-        return {_breakKeyword.get()};
+        return {};
     }
 
-    ContinueStatementSyntax::ContinueStatementSyntax(std::unique_ptr<SyntaxToken> continueKeyword): _continueKeyword(std::move(continueKeyword))
+    ContinueStatementSyntax::ContinueStatementSyntax(int continueKeyword): _continueKeyword(continueKeyword)
     {
 
     }
@@ -396,11 +349,11 @@ namespace trylang
 
     std::vector<SyntaxNode *> ContinueStatementSyntax::GetChildren()
     {
-        return {_continueKeyword.get()};
+        return {};
     }
 
-    ReturnStatementSyntax::ReturnStatementSyntax(std::unique_ptr<SyntaxToken> returnKeyword, std::unique_ptr<ExpressionSyntax> expression)
-        : _returnKeyword(std::move(returnKeyword)),
+    ReturnStatementSyntax::ReturnStatementSyntax(int returnKeyword, std::unique_ptr<ExpressionSyntax> expression)
+        : _returnKeyword(returnKeyword),
           _expression(std::move(expression))
     {
         
@@ -413,6 +366,6 @@ namespace trylang
 
     std::vector<SyntaxNode*> ReturnStatementSyntax::GetChildren()
     {
-        return {_returnKeyword.get(), _expression.get()};
+        return {_expression.get()};
     }
 }
\ No newline at end of file
@@ -0,0 +1,165 @@
+#include <codeanalysis/utils/FileTable.hpp>
+#include <codeanalysis/utils/StringTable.hpp>
+#include <codeanalysis/utils/Symbol.hpp>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace trylang
+{
+    FileTable::~FileTable()
+    {
+        this->CloseAll();
+    }
+
+    FileTable& FileTable::Instance()
+    {
+        static FileTable table;
+        return table;
+    }
+
+    int FileTable::Open(const std::string& path, const std::string& mode)
+    {
+        int flags;
+        if(mode == "r")
+        {
+            flags = O_RDONLY;
+        }
+        else if(mode == "w")
+        {
+            flags = O_WRONLY | O_CREAT | O_TRUNC;
+        }
+        else if(mode == "a")
+        {
+            flags = O_WRONLY | O_CREAT | O_APPEND;
+        }
+        else
+        {
+            throw std::runtime_error("open(): unknown mode '" + mode + "', expected r, w or a");
+        }
+
+        auto fd = open(path.c_str(), flags | O_CLOEXEC, 0666);
+        if(fd < 0)
+        {
+            throw std::runtime_error("open(): cannot open '" + path + "': " + std::strerror(errno));
+        }
+
+        auto& file = _files[fd];
+        file._path = path;
+        if(mode == "r")
+        {
+            file._reader = std::make_unique<Input>(fd);
+        }
+        else
+        {
+            file._writer = std::make_unique<Output>(fd);
+            file._writer->_policy = FlushPolicy::Full;
+        }
+
+        return fd;
+    }
+
+    Input& FileTable::Reader(int handle, const char* builtin)
+    {
+        auto found = _files.find(handle);
+        if(found == _files.end() || found->second._reader == nullptr)
+        {
+            throw std::runtime_error(std::string(builtin) + "(): " + std::to_string(handle) + " is not a file opened for reading");
+        }
+
+        return *found->second._reader;
+    }
+
+    Output& FileTable::Writer(int handle, const char* builtin)
+    {
+        auto found = _files.find(handle);
+        if(found == _files.end() || found->second._writer == nullptr)
+        {
+            throw std::runtime_error(std::string(builtin) + "(): " + std::to_string(handle) + " is not a file opened for writing");
+        }
+
+        return *found->second._writer;
+    }
+
+    void FileTable::Close(int handle)
+    {
+        auto found = _files.find(handle);
+        if(found == _files.end())
+        {
+            throw std::runtime_error("close(): " + std::to_string(handle) + " is not an open file");
+        }
+
+        auto path = std::move(found->second._path);
+        auto error = 0;
+        if(found->second._writer != nullptr)
+        {
+            found->second._writer->Close();
+            error = found->second._writer->_error;
+        }
+        _files.erase(found); /* Unmaps the reader before its file descriptor goes away */
+
+        if(::close(handle) != 0 && error == 0)
+        {
+            error = errno;
+        }
+        if(error != 0)
+        {
+            throw std::runtime_error("close(): writing '" + path + "' failed: " + std::strerror(error));
+        }
+    }
+
+    void FileTable::CloseAll() noexcept
+    {
+        for(auto& file: _files)
+        {
+            if(file.second._writer != nullptr)
+            {
+                file.second._writer->Close();
+            }
+            file.second._reader.reset();
+            ::close(file.first);
+        }
+        _files.clear();
+    }
+
+    namespace BUILT_IN_FUNCTIONS
+    {
+        Value Open(const Value* arguments)
+        {
+            return FileTable::Instance().Open(arguments[0].AsString(), arguments[1].AsString());
+        }
+
+        Value ReadLine(const Value* arguments)
+        {
+            auto line = FileTable::Instance().Reader(arguments[0].AsInt(), "readLine").NextLine();
+            return StringTable::Instance().InternInput(std::string(line));
+        }
+
+        Value HasLine(const Value* arguments)
+        {
+            return FileTable::Instance().Reader(arguments[0].AsInt(), "hasLine").HasLine();
+        }
+
+        Value Write(const Value* arguments)
+        {
+            const auto& text = arguments[1].AsString();
+            FileTable::Instance().Writer(arguments[0].AsInt(), "write").Write(text);
+            return static_cast<int>(text.size());
+        }
+
+        Value WriteLine(const Value* arguments)
+        {
+            const auto& text = arguments[1].AsString();
+            FileTable::Instance().Writer(arguments[0].AsInt(), "writeLine").WriteLine(text);
+            return static_cast<int>(text.size());
+        }
+
+        Value Close(const Value* arguments)
+        {
+            FileTable::Instance().Close(arguments[0].AsInt());
+            return 0;
+        }
+    }
+}
@@ -869,7 +869,7 @@ namespace trylang
         return var_alloc;
     }
 
-    void Generator::GenerateFunction(const std::unordered_map<std::string, std::shared_ptr<VariableSymbol>>& variables, const std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>& functionInfoAndBody)
+    void Generator::GenerateFunction(const std::unordered_map<std::string_view, std::shared_ptr<VariableSymbol>>& variables, const std::pair<std::shared_ptr<FunctionSymbol>, std::unique_ptr<BoundBlockStatement>>& functionInfoAndBody)
     {
         auto functionInfo = functionInfoAndBody.first.get();
         auto functionBody = functionInfoAndBody.second.get();
@@ -1037,7 +1037,7 @@ namespace trylang
 
     }
 
-    void Generator::SetupGlobalEnv(const std::unordered_map<std::string, std::shared_ptr<VariableSymbol>>& variables)
+    void Generator::SetupGlobalEnv(const std::unordered_map<std::string_view, std::shared_ptr<VariableSymbol>>& variables)
     {
 
         std::unordered_map<std::string, llvm::Value*> _globalObjectRecord = 
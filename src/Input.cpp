@@ -0,0 +1,144 @@
+#include <codeanalysis/input/Input.hpp>
+#include <codeanalysis/output/Output.hpp>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace trylang
+{
+    Input::Input(int fd)
+        : _fd(fd)
+    {}
+
+    Input::~Input()
+    {
+        if(_mapping != nullptr)
+        {
+            munmap(_mapping, _mappingSize);
+        }
+    }
+
+    Input& Input::Instance()
+    {
+        static Input input(STDIN_FILENO);
+        return input;
+    }
+
+    void Input::Open()
+    {
+        _opened = true;
+        _interactive = isatty(_fd);
+
+        /* A regular file is mapped from its current offset to its end, nothing is copied */
+        struct stat status{};
+        auto offset = lseek(_fd, 0, SEEK_CUR);
+        if(fstat(_fd, &status) == 0 && S_ISREG(status.st_mode) && offset >= 0 && status.st_size > offset)
+        {
+            auto* mapping = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, _fd, 0);
+            if(mapping != MAP_FAILED)
+            {
+                madvise(mapping, status.st_size, MADV_SEQUENTIAL);
+                _mapping = mapping;
+                _mappingSize = status.st_size;
+                _cursor = static_cast<const char*>(mapping) + offset;
+                _end = static_cast<const char*>(mapping) + status.st_size;
+                _exhausted = true;
+                return;
+            }
+        }
+
+        _block.resize(BLOCK_SIZE);
+        _cursor = _end = _block.data();
+    }
+
+    bool Input::Refill()
+    {
+        if(_exhausted)
+        {
+            return false;
+        }
+
+        if(_interactive)
+        {
+            Output::Instance().Flush(); /* A prompt printed before input() must be visible while we wait */
+        }
+
+        /* The unread part of the block moves to its front, the block grows when a single line does not fit */
+        auto pending = static_cast<std::size_t>(_end - _cursor);
+        if(pending == _block.size())
+        {
+            _block.resize(_block.size() * 2);
+            _cursor = _block.data();
+        }
+        std::memmove(_block.data(), _cursor, pending);
+
+        ssize_t count;
+        do
+        {
+            count = read(_fd, _block.data() + pending, _block.size() - pending);
+        }
+        while(count < 0 && errno == EINTR);
+
+        if(count < 0)
+        {
+            throw std::runtime_error("Failed to read file descriptor " + std::to_string(_fd) + ": " + std::strerror(errno));
+        }
+
+        _cursor = _block.data();
+        _end = _block.data() + pending + count;
+        _exhausted = count == 0;
+        return count > 0;
+    }
+
+    bool Input::HasLine()
+    {
+        if(!_opened)
+        {
+            this->Open();
+        }
+
+        while(_cursor == _end)
+        {
+            if(!this->Refill())
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    std::string_view Input::NextLine()
+    {
+        if(!this->HasLine())
+        {
+            return {};
+        }
+
+        /* Offsets survive the moves and reallocations of _block made by Refill */
+        std::size_t searched = 0;
+        while(true)
+        {
+            const auto* start = _cursor + searched;
+            const auto* newline = static_cast<const char*>(std::memchr(start, '\n', _end - start));
+            if(newline != nullptr)
+            {
+                std::string_view line(_cursor, newline - _cursor);
+                _cursor = newline + 1;
+                return line;
+            }
+
+            searched = _end - _cursor;
+            if(!this->Refill())
+            {
+                /* The last line of _fd has no '\n' */
+                std::string_view line(_cursor, _end - _cursor);
+                _cursor = _end;
+                return line;
+            }
+        }
+    }
+}
@@ -1,10 +1,17 @@
 #include <codeanalysis/parser/utils/SyntaxKind.hpp>
-#include <cctype>
 #include <codeanalysis/lexer/Lexer.hpp>
-#include <boost/lexical_cast.hpp>
-#include <codeanalysis/parser/utils/ExpressionSyntax.hpp> /* SyntaxToken */
+#include <codeanalysis/lexer/Keywords.hpp>
+#include <codeanalysis/utils/Number.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace trylang
@@ -15,14 +22,19 @@ namespace trylang
         return _buffer.str();
     }
 
-    Lexer::Lexer(std::string text) : _text(std::move(text))
+    Lexer::Lexer(std::string_view text, const Scanner& scanner) : Lexer(text, 0, text.size(), 1, _buffer, scanner)
     {
-        _current = 0;
-        _start = 0;
-        _line = 1;
-        _text_size = _text.size();
         _buffer.str("");
-        _tokens = std::vector<std::unique_ptr<SyntaxToken>>();
+    }
+
+    Lexer::Lexer(std::string_view text, std::size_t first, std::size_t last, int line, std::ostream& errors, const Scanner& scanner)
+        : _text(text), _errors(&errors), _scanner(scanner)
+    {
+        _current = static_cast<int>(first);
+        _start = _current;
+        _line = line;
+        _text_size = last;
+        _tokens._source = _text;
     }
 
     bool Lexer::IsAtEnd()
@@ -38,7 +50,7 @@ namespace trylang
             return '\0';
         }
 
-        return _text.at(index);
+        return _text[index];
     }
 
     char Lexer::Current()
@@ -64,24 +76,51 @@ namespace trylang
 
     char Lexer::Advance()
     {
-        return _text.at(_current++);
+        return _text[_current++];
+    }
+
+    const char* Lexer::At(int index)
+    {
+        return _text.data() + index;
+    }
+
+    const char* Lexer::End()
+    {
+        return _text.data() + _text_size;
+    }
+
+    void Lexer::MoveTo(const char* position)
+    {
+        _current = static_cast<int>(position - _text.data());
     }
 
     void Lexer::AddToken(SyntaxKind kind)
     {
-        this->AddToken(kind, std::nullopt);
+        if(_next != nullptr)
+        {
+            *_next = Token{kind, _line, static_cast<std::uint32_t>(_start), static_cast<std::uint32_t>(_current - _start), {}};
+            _next = nullptr;
+            return;
+        }
+
+        _tokens.Add(kind, _line, _start, _current - _start);
     }
 
     void Lexer::AddToken(SyntaxKind kind, object_t&& value)
     {
-        int length = _current - _start;
-        std::string extracted_lexeme = _text.substr(_start, length);
-        _tokens.emplace_back(std::make_unique<SyntaxToken>(kind, _line, std::move(extracted_lexeme), std::move(value)));
+        if(_next != nullptr)
+        {
+            *_next = Token{kind, _line, static_cast<std::uint32_t>(_start), static_cast<std::uint32_t>(_current - _start), std::move(value)};
+            _next = nullptr;
+            return;
+        }
+
+        _tokens.Add(kind, _line, _start, _current - _start, std::move(value));
     }
 
     void Lexer::GenerateError(std::string message)
     {
-        _buffer << "[line " << _line << "] Error: " << message << "\n";
+        *_errors << "[line " << _line << "] Error: " << message << "\n";
     }
 
     void Lexer::ReadStringLiteral()
@@ -91,16 +130,8 @@ namespace trylang
             the string. We also handle running out of input before the string literal
             is closed and report an error for that.
         */
-        while(this->Current() != '"' && !this->IsAtEnd())
-        {
-            /* We support multi-line string literals */
-            if(this->Current() == '\n')
-            {
-                _line++;
-            }
-
-            this->Advance();
-        }
+        /* We support multi-line string literals */
+        this->MoveTo(_scanner._until(this->At(_current), this->End(), '"', _line));
 
         if(this->IsAtEnd())
         {
@@ -113,54 +144,29 @@ namespace trylang
 
         /* Trim the staring quote and ending quote */
         int length = (_current - 1) - (_start + 1);
-        std::string value = _text.substr(_start + 1, length);
+        std::string value(_text.substr(_start + 1, length));
         this->AddToken(SyntaxKind::StringToken, value);
     }
 
     void Lexer::ReadIdentifier()
     {
-        while(std::isalnum(this->Current()))
-        {
-            this->Advance();
-        }
-
-        int length = _current - _start;
-        std::string text = _text.substr(_start, length);
-        SyntaxKind kind;
-
-        auto it = _keywords.find(text);
-        if(it != _keywords.end())
-        {
-            kind = it->second;
-        }
-        else
-        {
-            kind = SyntaxKind::IdentifierToken;
-        }
-
-        this->AddToken(kind, text);
+        this->MoveTo(_scanner._identifier(this->At(_current), this->End()));
+        this->AddToken(KeywordKind(_text.substr(_start, _current - _start)));
     }
 
     void Lexer::ReadNumberLiteral()
     {
         /* Till now int is unsupported */
-        while(std::isdigit(this->Current()))
-        {
-            /* m_current is changed to point to next character but the m_start is at the start of the number lexeme */
-            this->Advance();
-        }
+        /* m_current is moved past the digits but the m_start is at the start of the number lexeme */
+        this->MoveTo(_scanner._digits(this->At(_current), this->End()));
 
-        int length = _current - _start;
-        auto text = _text.substr(_start, length);
-            
-        int value = -1;
-        try
-        {
-            value = boost::lexical_cast<int>(text);
-        }
-        catch(const boost::bad_lexical_cast&)
+        /* Parsed in place, the lexeme is only copied for the error message */
+        auto parsed = ParseInt(_text.data() + _start, _text.data() + _current);
+        int value = parsed._value;
+        if(!parsed.Ok())
         {
-            this->GenerateError("The number '" + text + "' cannot be represented by an Int32");
+            value = -1;
+            this->GenerateError("The number '" + std::string(_text.substr(_start, _current - _start)) + "' cannot be represented by an Int32");
         }
 
         this->AddToken(SyntaxKind::NumberToken, value);
@@ -216,10 +222,7 @@ namespace trylang
                     if(this->Match('/'))
                     {
                         /* A comment goes until the end of the line */
-                        while(this->Current() != '\n' && !this->IsAtEnd())
-                        {
-                            this->Advance();
-                        }
+                        this->MoveTo(_scanner._until(this->At(_current), this->End(), '\n', _line));
                     }
                     else
                     {
@@ -230,24 +233,27 @@ namespace trylang
             case ' ':
             case '\r':
             case '\t':
+            case '\n':
                 /* 
                     Ignore whitespace
-                    When encountering whitespace, we simply go back to the beginning of the scan loop
-                    We dumped the returned consumed character by advance()
+                    A lone ' ' is the common case. Longer runs {indentation, blank lines} are skipped in one call
+                    from the character advance() consumed, counting the lines they end
                 */
-                break;
-            case '\n':
-                _line++;
+                if(ch == ' ' && this->Current() != ' ' && this->Current() != '\n')
+                {
+                    break;
+                }
+                this->MoveTo(_scanner._whitespace(this->At(_start), this->End(), _line));
                 break;
             case '"':
                 this->ReadStringLiteral();
                 break;
             default:
-                if(std::isdigit(ch))
+                if(IsDigit(ch))
                 {
                     this->ReadNumberLiteral();
                 }
-                else if(std::isalnum(ch))
+                else if(IsAlphaNumeric(ch))
                 {
                     this->ReadIdentifier();
                 }
@@ -260,7 +266,7 @@ namespace trylang
         }
     }
 
-    std::vector<std::unique_ptr<SyntaxToken>> Lexer::Tokenize()
+    void Lexer::ScanTokens()
     {
         while(!this->IsAtEnd())
         {
@@ -274,23 +280,301 @@ namespace trylang
             */
             this->ScanToken();
         }
+    }
 
-        _tokens.emplace_back(std::make_unique<SyntaxToken>(SyntaxKind::EndOfFileToken, _current, "\0", std::nullopt));
+    TokenStream Lexer::Tokenize()
+    {
+        this->ScanTokens();
+        _tokens.Add(SyntaxKind::EndOfFileToken, _current, _text_size, 0);
 
         return std::move(_tokens);
     }
 
-    std::vector<std::unique_ptr<SyntaxToken>> Lexer::Tokenizer(std::string&& text)
+    int Lexer::Fill(Token* tokens, int count)
     {
-        Lexer lexer(std::move(text));
+        /* AddToken() writes the token straight into tokens and resets _next, nothing is stored in _tokens */
+        int filled = 0;
+        while(filled < count && !this->IsAtEnd())
+        {
+            _next = tokens + filled;
+            _start = _current;
+            this->ScanToken();
+            if(_next == nullptr)
+            {
+                filled++;
+            }
+        }
+        _next = nullptr;
 
-        auto tokens = lexer.Tokenize();
+        if(filled < count && this->IsAtEnd())
+        {
+            tokens[filled++] = Token{SyntaxKind::EndOfFileToken, _current, static_cast<std::uint32_t>(_text_size), 0, {}};
+        }
+        return filled;
+    }
+
+    TokenStream Lexer::Tokenizer(std::string_view text, unsigned threads)
+    {
+        auto tokens = Lexer::TokenizeParallel(text, threads);
+        Lexer::PrintErrors();
+        return tokens;
+    }
+
+    void Lexer::PrintErrors()
+    {
         if(!Lexer::Errors().empty())
         {
             std::cout << "Tokenization Errors Reported:\n";
             std::cout << "\n" << Lexer::Errors() << "\n";
         }
+    }
+
+    namespace
+    {
+        constexpr std::size_t PARALLEL_REGION_SIZE = 1 << 20; /* Smallest piece of text worth a thread */
+
+        /* Runs job(0) .. job(count - 1) on up to threads threads, the calling thread being one of them */
+        void ParallelFor(std::size_t count, unsigned threads, const std::function<void(std::size_t)>& job)
+        {
+            std::atomic<std::size_t> next{0};
+            std::exception_ptr failure;
+            std::mutex failureMutex;
+
+            auto worker = [&] {
+                for(auto index = next++; index < count; index = next++)
+                {
+                    try
+                    {
+                        job(index);
+                    }
+                    catch(...)
+                    {
+                        std::lock_guard<std::mutex> lock(failureMutex);
+                        if(!failure)
+                        {
+                            failure = std::current_exception();
+                        }
+                    }
+                }
+            };
+
+            std::vector<std::thread> pool;
+            for(unsigned thread = 1; thread < threads && thread < count; thread++)
+            {
+                pool.emplace_back(worker);
+            }
+            worker();
+
+            for(auto& thread: pool)
+            {
+                thread.join();
+            }
+
+            if(failure)
+            {
+                std::rethrow_exception(failure);
+            }
+        }
+
+        /*
+         *  A region of the text starts after a newline. A comment always ends at a newline, so the only thing the
+         *  Lexer can be in the middle of at that point is a string literal
+         * */
+        struct Region
+        {
+            bool _endsInString = false;
+            int _newlines = 0;
+            const char* _split = nullptr;   /* Position after the first newline outside of a string, nullptr without one */
+            int _newlinesBeforeSplit = 0;
+        };
+
+        Region ScanRegion(const char* first, const char* last, bool inString)
+        {
+            Region region;
+            for(auto* position = first; position != last; position++)
+            {
+                switch(*position)
+                {
+                    case '\n':
+                        region._newlines++;
+                        if(!inString && region._split == nullptr)
+                        {
+                            region._split = position + 1;
+                            region._newlinesBeforeSplit = region._newlines;
+                        }
+                        break;
+                    case '"':
+                        inString = !inString;
+                        break;
+                    case '/':
+                        if(!inString && position + 1 != last && position[1] == '/')
+                        {
+                            /* Skipped up to the newline ending the comment, which is counted by the next iteration */
+                            auto* newline = static_cast<const char*>(std::memchr(position, '\n', last - position));
+                            position = (newline == nullptr ? last : newline) - 1;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+            region._endsInString = inString;
+            return region;
+        }
+    }
+
+    TokenStream Lexer::TokenizeParallel(std::string_view text, unsigned threads)
+    {
+        if(threads < 2 || text.size() < 2 * PARALLEL_REGION_SIZE)
+        {
+            Lexer lexer(text);
+            return lexer.Tokenize();
+        }
+
+        _buffer.str("");
+        const char* data = text.data();
+
+        /* Regions start right after a newline */
+        auto regionSize = std::max<std::size_t>(text.size() / (threads * 4), PARALLEL_REGION_SIZE);
+        std::vector<std::size_t> starts{0};
+        while(starts.back() + regionSize < text.size())
+        {
+            auto newline = text.find('\n', starts.back() + regionSize);
+            if(newline == std::string_view::npos || newline + 1 == text.size())
+            {
+                break;
+            }
+            starts.push_back(newline + 1);
+        }
+        auto regionCount = starts.size();
+        starts.push_back(text.size());
+
+        /* Every region is scanned as if it started outside of a string, the few which do not are scanned again */
+        std::vector<Region> regions(regionCount);
+        ParallelFor(regionCount, threads, [&](std::size_t index) {
+            regions[index] = ScanRegion(data + starts[index], data + starts[index + 1], false);
+        });
+
+        /* A chunk starts where a region starts outside of a string, or past the string the region starts in */
+        std::vector<std::size_t> chunkStarts;
+        std::vector<int> chunkLines;
+        bool inString = false;
+        int line = 1;
+        for(std::size_t index = 0; index < regionCount; index++)
+        {
+            if(!inString)
+            {
+                chunkStarts.push_back(starts[index]);
+                chunkLines.push_back(line);
+            }
+            else
+            {
+                regions[index] = ScanRegion(data + starts[index], data + starts[index + 1], true);
+                if(regions[index]._split != nullptr)
+                {
+                    chunkStarts.push_back(regions[index]._split - data);
+                    chunkLines.push_back(line + regions[index]._newlinesBeforeSplit);
+                }
+            }
 
+            line += regions[index]._newlines;
+            inString = regions[index]._endsInString;
+        }
+        auto chunkCount = chunkStarts.size();
+        chunkStarts.push_back(text.size());
+
+        std::vector<TokenStream> chunks(chunkCount);
+        std::vector<std::stringstream> errors(chunkCount);
+        ParallelFor(chunkCount, threads, [&](std::size_t index) {
+            Lexer lexer(text, chunkStarts[index], chunkStarts[index + 1], chunkLines[index], errors[index]);
+            lexer.ScanTokens();
+            chunks[index] = std::move(lexer._tokens);
+        });
+
+        for(const auto& chunkErrors: errors)
+        {
+            _buffer << chunkErrors.str();
+        }
+
+        /* Stitched back in order, the literal indices of a chunk move past the values of the chunks before it */
+        std::vector<std::size_t> firstToken{0};
+        std::vector<std::size_t> firstValue{0};
+        for(const auto& chunk: chunks)
+        {
+            firstToken.push_back(firstToken.back() + chunk.Size());
+            firstValue.push_back(firstValue.back() + chunk._values.size());
+        }
+
+        TokenStream tokens;
+        tokens._source = text;
+        tokens._kinds.resize(firstToken.back());
+        tokens._lines.resize(firstToken.back());
+        tokens._offsets.resize(firstToken.back());
+        tokens._lengths.resize(firstToken.back());
+        tokens._literals.resize(firstToken.back());
+        tokens._values.resize(firstValue.back());
+
+        ParallelFor(chunkCount, threads, [&](std::size_t index) {
+            auto& chunk = chunks[index];
+            auto at = firstToken[index];
+            auto shift = static_cast<int>(firstValue[index]);
+
+            std::copy(chunk._kinds.begin(), chunk._kinds.end(), tokens._kinds.begin() + at);
+            std::copy(chunk._lines.begin(), chunk._lines.end(), tokens._lines.begin() + at);
+            std::copy(chunk._offsets.begin(), chunk._offsets.end(), tokens._offsets.begin() + at);
+            std::copy(chunk._lengths.begin(), chunk._lengths.end(), tokens._lengths.begin() + at);
+            std::transform(chunk._literals.begin(), chunk._literals.end(), tokens._literals.begin() + at, [shift](int literal) {
+                return literal == -1 ? -1 : literal + shift;
+            });
+            std::move(chunk._values.begin(), chunk._values.end(), tokens._values.begin() + firstValue[index]);
+            chunk = TokenStream();
+        });
+
+        /* Same line as the serial Lexer gives it */
+        tokens.Add(SyntaxKind::EndOfFileToken, static_cast<int>(text.size()), text.size(), 0);
         return tokens;
     }
+
+    void Lexer::Benchmark(std::string_view text, int rounds, unsigned threads, std::ostream& out)
+    {
+        for(auto name: {"scalar", "sse2", "avx2"})
+        {
+            const auto* scanner = Scanner::Find(name);
+            if(scanner == nullptr)
+            {
+                continue;
+            }
+
+            std::size_t tokens = 0;
+            auto start = std::chrono::steady_clock::now();
+            for(auto round = 0; round < rounds; round++)
+            {
+                Lexer lexer(text, *scanner);
+                tokens = lexer.Tokenize().Size();
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            auto megabytes = static_cast<double>(text.size()) * rounds / (1024 * 1024);
+            out << "lexer " << name << ": " << megabytes / elapsed.count() << " MB/s {" << tokens << " tokens}\n";
+        }
+
+        for(unsigned count = 2; threads > 1; count = std::min(count * 2, threads))
+        {
+            std::size_t tokens = 0;
+            auto start = std::chrono::steady_clock::now();
+            for(auto round = 0; round < rounds; round++)
+            {
+                tokens = Lexer::TokenizeParallel(text, count).Size();
+            }
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+            auto megabytes = static_cast<double>(text.size()) * rounds / (1024 * 1024);
+            out << "lexer " << Scanner::Instance()._name << " x" << count << ": " << megabytes / elapsed.count() << " MB/s {" << tokens << " tokens}\n";
+
+            if(count == threads)
+            {
+                break;
+            }
+        }
+    }
 }
\ No newline at end of file
@@ -1,12 +1,98 @@
 #include <codeanalysis/binder/utils/BoundExpressionNode.hpp>
 #include <codeanalysis/parser/utils/ExpressionSyntax.hpp>
 #include <codeanalysis/lower/Lower.hpp>
+#include <algorithm>
+#include <cstring>
 #include <memory>
 #include <stack>
 #include <random>
+#include <stdexcept>
+#include <unordered_map>
 
 namespace trylang
 {
+    namespace
+    {
+        bool IsUserCall(BoundExpressionNode* node)
+        {
+            return node->Kind() == BoundNodeKind::CallExpression && static_cast<BoundCallExpression*>(node)->_function->_declaration != nullptr;
+        }
+
+        /* True when node or one of its operands satisfies predicate */
+        template<typename Predicate>
+        bool Contains(BoundExpressionNode* node, Predicate predicate)
+        {
+            if(predicate(node))
+            {
+                return true;
+            }
+
+            switch(node->Kind())
+            {
+                case BoundNodeKind::AssignmentExpression:
+                    return Contains(static_cast<BoundAssignmentExpression*>(node)->_expression.get(), predicate);
+                case BoundNodeKind::UnaryExpression:
+                    return Contains(static_cast<BoundUnaryExpression*>(node)->_operand.get(), predicate);
+                case BoundNodeKind::ConversionExpression:
+                    return Contains(static_cast<BoundConversionExpression*>(node)->_expression.get(), predicate);
+                case BoundNodeKind::BinaryExpression:
+                {
+                    auto* expr = static_cast<BoundBinaryExpression*>(node);
+                    return Contains(expr->_left.get(), predicate) || Contains(expr->_right.get(), predicate);
+                }
+                case BoundNodeKind::ShortCircuitExpression:
+                {
+                    auto* expr = static_cast<BoundShortCircuitExpression*>(node);
+                    return Contains(expr->_left.get(), predicate) || Contains(expr->_right.get(), predicate);
+                }
+                case BoundNodeKind::AppendExpression:
+                {
+                    const auto& parts = static_cast<BoundAppendExpression*>(node)->_parts;
+                    return std::any_of(parts.begin(), parts.end(), [&predicate](const auto& part) { return Contains(part.get(), predicate); });
+                }
+                case BoundNodeKind::ConcatExpression:
+                {
+                    const auto& parts = static_cast<BoundConcatExpression*>(node)->_parts;
+                    return std::any_of(parts.begin(), parts.end(), [&predicate](const auto& part) { return Contains(part.get(), predicate); });
+                }
+                case BoundNodeKind::CallExpression:
+                {
+                    const auto& arguments = static_cast<BoundCallExpression*>(node)->_arguments;
+                    return std::any_of(arguments.begin(), arguments.end(), [&predicate](const auto& argument) { return Contains(argument.get(), predicate); });
+                }
+                default:
+                    return false;
+            }
+        }
+
+        bool ContainsUserCall(BoundExpressionNode* node)
+        {
+            return Contains(node, IsUserCall);
+        }
+
+        /*
+         *  A print of a concatenation needs no intermediate string when its parts can neither print nor fail half way
+         *  through the line, which holds once no call is left in them
+         * */
+        void MarkStreamedPrint(BoundExpressionNode* node)
+        {
+            if(node->Kind() != BoundNodeKind::CallExpression)
+            {
+                return;
+            }
+
+            auto* call = static_cast<BoundCallExpression*>(node);
+            if(IsUserCall(node) || call->_function->_name != BUILT_IN_FUNCTIONS::MAP.at("print")->_name)
+            {
+                return;
+            }
+
+            auto* message = call->_arguments[0].get();
+            auto isCall = [](BoundExpressionNode* expression) { return expression->Kind() == BoundNodeKind::CallExpression; };
+            call->_streamed = message->Kind() == BoundNodeKind::ConcatExpression && !Contains(message, isCall);
+        }
+    }
+
 
     LabelSymbol Lower::GenerateLabel()
     {
@@ -15,6 +101,20 @@ namespace trylang
         return label;
     }
 
+    std::shared_ptr<VariableSymbol> Lower::GenerateTemporary(const char* type)
+    {
+        auto index = _variableCount + _temporaryCount++;
+        _temporaryLimit = std::max(_temporaryLimit, _temporaryCount);
+
+        auto name = "Temporary{" + std::to_string(index) + "}";
+        if(_function == nullptr)
+        {
+            return std::make_shared<GlobalVariableSymbol>(std::move(name), false, type, index);
+        }
+
+        return std::make_shared<LocalVariableSymbol>(std::move(name), false, type, index);
+    }
+
     /* All the BoundBlockStatement will be removed and flattened into their BoundStatementNode */
     std::unique_ptr<BoundBlockStatement> Lower::Flatten(std::unique_ptr<BoundStatementNode> statement)
     {
@@ -46,6 +146,46 @@ namespace trylang
 
     }
 
+    /* Resolves every goto of the flattened body to the index of the statement following its label */
+    void Lower::Link(BoundBlockStatement* body)
+    {
+        auto& statements = body->_statements;
+        statements.erase(std::remove(statements.begin(), statements.end(), nullptr), statements.end());
+
+        std::unordered_map<int, int> labelToIndex;
+        for(auto i = 0; i < statements.size(); i++)
+        {
+            if(statements[i]->Kind() == BoundNodeKind::LabelStatement)
+            {
+                labelToIndex[static_cast<BoundLabelStatement*>(statements[i].get())->_label._id] = i + 1;
+            }
+        }
+
+        auto resolve = [&labelToIndex](const LabelSymbol& label)
+        {
+            auto it = labelToIndex.find(label._id);
+            if(it == labelToIndex.end())
+            {
+                throw std::logic_error("Lower: Unknown label " + label._name); /* Logically this throw may never occur */
+            }
+            return it->second;
+        };
+
+        for(const auto& statement: statements)
+        {
+            if(statement->Kind() == BoundNodeKind::GotoStatement)
+            {
+                auto* node = static_cast<BoundGotoStatement*>(statement.get());
+                node->_target = resolve(node->_label);
+            }
+            else if(statement->Kind() == BoundNodeKind::ConditionalGotoStatement)
+            {
+                auto* node = static_cast<BoundConditionalGotoStatement*>(statement.get());
+                node->_target = resolve(node->_label);
+            }
+        }
+    }
+
     std::unique_ptr<BoundStatementNode> Lower::RewriteStatement(std::unique_ptr<BoundStatementNode> node)
     {
         if(node == nullptr)
@@ -82,25 +222,22 @@ namespace trylang
     {
         auto* stmt = static_cast<BoundBlockStatement*>(node.get());
 
-        std::vector<std::unique_ptr<BoundStatementNode>> statements(stmt->_statements.size() + 2);
-
-        LabelSymbol blockStartLabel("StartBlockLabel");
-        statements.emplace_back(std::make_unique<BoundLabelStatement>(blockStartLabel));
+        /* Variables are resolved to frame slots and global indices by the Binder, so a block needs no runtime scope of its own */
+        std::vector<std::unique_ptr<BoundStatementNode>> statements;
+        statements.reserve(stmt->_statements.size());
 
         for(int i = 0; i < stmt->_statements.size(); i++)
         {
             statements.emplace_back(this->RewriteStatement(std::move(stmt->_statements.at(i))));
         }
 
-        LabelSymbol blockEndLabel("EndBlockLabel");
-        statements.emplace_back(std::make_unique<BoundLabelStatement>(blockEndLabel));
-
         return std::make_unique<BoundBlockStatement>(std::move(statements));
     }
 
     std::unique_ptr<BoundStatementNode> Lower::RewriteVariableDeclaration(std::unique_ptr<BoundStatementNode> node)
     {
         auto* stmt = static_cast<BoundVariableDeclaration*>(node.get());
+        stmt->_expression = this->RewriteExpression(std::move(stmt->_expression));
         return node;
     }
 
@@ -273,18 +410,78 @@ namespace trylang
     std::unique_ptr<BoundStatementNode> Lower::RewriteConditionalGotoStatement(std::unique_ptr<BoundStatementNode> node)
     {
         auto* stmt = static_cast<BoundConditionalGotoStatement*>(node.get());
-        return node;
+
+        auto isLogical = [](BoundExpressionNode* condition, BoundNodeKind kind)
+        {
+            return condition->Kind() == BoundNodeKind::BinaryExpression && static_cast<BoundBinaryExpression*>(condition)->_op->_kind == kind;
+        };
+
+        bool isAnd = isLogical(stmt->_condition.get(), BoundNodeKind::LogicalAnd);
+        bool isOr = isLogical(stmt->_condition.get(), BoundNodeKind::LogicalOr);
+
+        if(!isAnd && !isOr)
+        {
+            stmt->_condition = this->RewriteExpression(std::move(stmt->_condition));
+            return node;
+        }
+
+        /**
+         * A branch on && or || becomes a chain of branches, so the right operand is skipped when the left one decides
+         *
+         * gotoIfFalse <left && right> label            gotoIfTrue <left || right> label
+         * ----------------------------------->         ----------------------------------->
+         * gotoIfFalse <left> label                     gotoIfTrue <left> label
+         * gotoIfFalse <right> label                    gotoIfTrue <right> label
+         *
+         *
+         * gotoIfTrue <left && right> label             gotoIfFalse <left || right> label
+         * ----------------------------------->         ----------------------------------->
+         * gotoIfFalse <left> skip                      gotoIfTrue <left> skip
+         * gotoIfTrue <right> label                     gotoIfFalse <right> label
+         * skip:                                        skip:
+         *
+         * */
+        auto* condition = static_cast<BoundBinaryExpression*>(stmt->_condition.get());
+        std::vector<std::unique_ptr<BoundStatementNode>> statements_1;
+
+        if(isAnd == stmt->_jumpIfFalse)
+        {
+            statements_1.emplace_back(std::make_unique<BoundConditionalGotoStatement>(stmt->_label, std::move(condition->_left), stmt->_jumpIfFalse));
+            statements_1.emplace_back(std::make_unique<BoundConditionalGotoStatement>(stmt->_label, std::move(condition->_right), stmt->_jumpIfFalse));
+        }
+        else
+        {
+            auto skipLabel = this->GenerateLabel();
+            statements_1.emplace_back(std::make_unique<BoundConditionalGotoStatement>(skipLabel, std::move(condition->_left), !stmt->_jumpIfFalse));
+            statements_1.emplace_back(std::make_unique<BoundConditionalGotoStatement>(stmt->_label, std::move(condition->_right), stmt->_jumpIfFalse));
+            statements_1.emplace_back(std::make_unique<BoundLabelStatement>(skipLabel));
+        }
+
+        auto result = std::make_unique<BoundBlockStatement>(std::move(statements_1));
+
+        return this->RewriteStatement(std::move(result));
     }
 
     std::unique_ptr<BoundStatementNode> Lower::RewriteReturnStatement(std::unique_ptr<BoundStatementNode> node)
     {
         auto* stmt = static_cast<BoundReturnStatement*>(node.get());
+        if(stmt->_expression != nullptr)
+        {
+            stmt->_expression = this->RewriteExpression(std::move(stmt->_expression));
+
+            /* "return f(...)" needs nothing from the current frame once the arguments are evaluated, so the engines can reuse it */
+            if(stmt->_expression->Kind() == BoundNodeKind::CallExpression)
+            {
+                stmt->_isTailCall = static_cast<BoundCallExpression*>(stmt->_expression.get())->_function->_declaration != nullptr;
+            }
+        }
         return node;
     }
 
     std::unique_ptr<BoundStatementNode> Lower::RewriteExpressionStatement(std::unique_ptr<BoundStatementNode> node)
     {
         auto* stmt = static_cast<BoundExpressionStatement*>(node.get());
+        stmt->_expression = this->RewriteExpression(std::move(stmt->_expression));
         return node;
     }
 
@@ -308,6 +505,8 @@ namespace trylang
                 return RewriteCallExpression(std::move(node));
             case BoundNodeKind::ConversionExpression:
                 return RewriteConversionExpression(std::move(node));
+            case BoundNodeKind::ConcatExpression:
+                return RewriteConcatExpression(std::move(node));
             default:
                 throw std::logic_error("Lower: Unexpected syntax " + __boundNodeStringMap[node->Kind()]);
 
@@ -335,39 +534,343 @@ namespace trylang
     std::unique_ptr<BoundExpressionNode> Lower::RewriteAssignmentExpression(std::unique_ptr<BoundExpressionNode> node)
     {
         auto* expr = static_cast<BoundAssignmentExpression*>(node.get());
+        expr->_expression = this->RewriteExpression(std::move(expr->_expression));
+
+        if(std::strcmp(expr->_variable->_type, Types::STRING->Name()) == 0)
+        {
+            return this->RewriteSelfAppend(std::move(node));
+        }
+
         return node;   
     }
 
+    /* "x = x + a + b" binds to x = concat(x, a, b), it becomes x += a, b when neither a nor b can read or change x */
+    std::unique_ptr<BoundExpressionNode> Lower::RewriteSelfAppend(std::unique_ptr<BoundExpressionNode> node)
+    {
+        auto* expr = static_cast<BoundAssignmentExpression*>(node.get());
+        auto* variable = expr->_variable.get();
+
+        if(expr->_expression->Kind() != BoundNodeKind::ConcatExpression)
+        {
+            return node;
+        }
+
+        auto& parts = static_cast<BoundConcatExpression*>(expr->_expression.get())->_parts;
+        auto* first = parts.front().get();
+        if(first->Kind() != BoundNodeKind::VariableExpression || static_cast<BoundVariableExpression*>(first)->_variable.get() != variable)
+        {
+            return node;
+        }
+
+        /* Callees can only reach globals */
+        auto isGlobal = variable->Kind() == SymbolKind::GlobalVariable;
+        auto touchesVariable = [variable, isGlobal](BoundExpressionNode* current)
+        {
+            switch(current->Kind())
+            {
+                case BoundNodeKind::VariableExpression:
+                    return static_cast<BoundVariableExpression*>(current)->_variable.get() == variable;
+                case BoundNodeKind::AssignmentExpression:
+                case BoundNodeKind::AppendExpression:
+                    return true;
+                case BoundNodeKind::CallExpression:
+                    return isGlobal && IsUserCall(current);
+                default:
+                    return false;
+            }
+        };
+
+        if(std::any_of(parts.begin() + 1, parts.end(), [&touchesVariable](const auto& part) { return Contains(part.get(), touchesVariable); }))
+        {
+            return node;
+        }
+
+        parts.erase(parts.begin());
+        return std::make_unique<BoundAppendExpression>(expr->_variable, std::move(parts));
+    }
+
+    std::unique_ptr<BoundExpressionNode> Lower::RewriteConcatExpression(std::unique_ptr<BoundExpressionNode> node)
+    {
+        auto* expr = static_cast<BoundConcatExpression*>(node.get());
+        for(auto& part: expr->_parts)
+        {
+            part = this->RewriteExpression(std::move(part));
+        }
+        return node;
+    }
+
     std::unique_ptr<BoundExpressionNode> Lower::RewriteCallExpression(std::unique_ptr<BoundExpressionNode> node)
     {
         auto* expr = static_cast<BoundCallExpression*>(node.get());
+        for(auto& argument: expr->_arguments)
+        {
+            argument = this->RewriteExpression(std::move(argument));
+        }
         return node;
     }
 
     std::unique_ptr<BoundExpressionNode> Lower::RewriteConversionExpression(std::unique_ptr<BoundExpressionNode> node)
     {
         auto* expr = static_cast<BoundConversionExpression*>(node.get());
+        expr->_expression = this->RewriteExpression(std::move(expr->_expression));
         return node;
     }
 
     std::unique_ptr<BoundExpressionNode> Lower::RewriteUnaryExpression(std::unique_ptr<BoundExpressionNode> node)
     {
         auto* expr = static_cast<BoundUnaryExpression*>(node.get());
+        expr->_operand = this->RewriteExpression(std::move(expr->_operand));
         return node;
     }
 
     std::unique_ptr<BoundExpressionNode> Lower::RewriteBinaryExpression(std::unique_ptr<BoundExpressionNode> node)
     {
         auto* expr = static_cast<BoundBinaryExpression*>(node.get());
+        expr->_left = this->RewriteExpression(std::move(expr->_left));
+        expr->_right = this->RewriteExpression(std::move(expr->_right));
+
+        if(expr->_op->_kind == BoundNodeKind::LogicalAnd || expr->_op->_kind == BoundNodeKind::LogicalOr)
+        {
+            return std::make_unique<BoundShortCircuitExpression>(std::move(expr->_left), expr->_op, std::move(expr->_right));
+        }
+
         return node;
     }
 
-    std::unique_ptr<BoundBlockStatement> Lower::RewriteAndFlatten(std::unique_ptr<BoundStatementNode> statement)
+    void Lower::HoistCalls(BoundBlockStatement* body)
+    {
+        std::vector<std::unique_ptr<BoundStatementNode>> statements;
+        statements.reserve(body->_statements.size());
+
+        for(auto& statement: body->_statements)
+        {
+            if(statement == nullptr)
+            {
+                continue;
+            }
+
+            /* Temporaries only live until the statement which reads them, so every statement reuses the same slots */
+            _temporaryCount = 0;
+
+            switch(statement->Kind())
+            {
+                case BoundNodeKind::VariableDeclarationStatement:
+                {
+                    auto* stmt = static_cast<BoundVariableDeclaration*>(statement.get());
+                    stmt->_expression = this->HoistTopExpression(std::move(stmt->_expression), statements);
+                    break;
+                }
+                case BoundNodeKind::ExpressionStatement:
+                {
+                    auto* stmt = static_cast<BoundExpressionStatement*>(statement.get());
+                    stmt->_expression = this->HoistTopExpression(std::move(stmt->_expression), statements);
+                    break;
+                }
+                case BoundNodeKind::ConditionalGotoStatement:
+                {
+                    auto* stmt = static_cast<BoundConditionalGotoStatement*>(statement.get());
+                    stmt->_condition = this->HoistExpression(std::move(stmt->_condition), statements);
+                    break;
+                }
+                case BoundNodeKind::ReturnStatement:
+                {
+                    auto* stmt = static_cast<BoundReturnStatement*>(statement.get());
+                    if(stmt->_expression != nullptr)
+                    {
+                        stmt->_expression = this->HoistTopExpression(std::move(stmt->_expression), statements);
+                    }
+                    break;
+                }
+                default:
+                    break;
+            }
+
+            statements.emplace_back(std::move(statement));
+        }
+
+        body->_statements = std::move(statements);
+    }
+
+    /* A call which is the whole expression of a statement stays in place, only its arguments are hoisted */
+    std::unique_ptr<BoundExpressionNode> Lower::HoistTopExpression(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements)
+    {
+        if(!IsUserCall(node.get()))
+        {
+            node = this->HoistExpression(std::move(node), statements);
+            MarkStreamedPrint(node.get());
+            return node;
+        }
+
+        this->HoistArguments(static_cast<BoundCallExpression*>(node.get()), statements);
+        return node;
+    }
+
+    void Lower::HoistArguments(BoundCallExpression* node, std::vector<std::unique_ptr<BoundStatementNode>>& statements)
+    {
+        std::vector<std::unique_ptr<BoundExpressionNode>*> operands;
+        for(auto& argument: node->_arguments)
+        {
+            operands.emplace_back(&argument);
+        }
+        this->HoistOperands(std::move(operands), statements);
+    }
+
+    std::unique_ptr<BoundExpressionNode> Lower::HoistExpression(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements)
+    {
+        if(!ContainsUserCall(node.get()))
+        {
+            return node;
+        }
+
+        switch(node->Kind())
+        {
+            case BoundNodeKind::CallExpression:
+            {
+                this->HoistArguments(static_cast<BoundCallExpression*>(node.get()), statements);
+                if(!IsUserCall(node.get()))
+                {
+                    return node; /* print(f(x)) */
+                }
+                return this->Spill(std::move(node), statements);
+            }
+            case BoundNodeKind::AssignmentExpression:
+            {
+                auto* expr = static_cast<BoundAssignmentExpression*>(node.get());
+                expr->_expression = this->HoistExpression(std::move(expr->_expression), statements);
+                return node;
+            }
+            case BoundNodeKind::UnaryExpression:
+            {
+                auto* expr = static_cast<BoundUnaryExpression*>(node.get());
+                expr->_operand = this->HoistExpression(std::move(expr->_operand), statements);
+                return node;
+            }
+            case BoundNodeKind::ConversionExpression:
+            {
+                auto* expr = static_cast<BoundConversionExpression*>(node.get());
+                expr->_expression = this->HoistExpression(std::move(expr->_expression), statements);
+                return node;
+            }
+            case BoundNodeKind::BinaryExpression:
+            {
+                auto* expr = static_cast<BoundBinaryExpression*>(node.get());
+                this->HoistOperands({&expr->_left, &expr->_right}, statements);
+                return node;
+            }
+            case BoundNodeKind::ShortCircuitExpression:
+                return this->HoistShortCircuitExpression(std::move(node), statements);
+            case BoundNodeKind::AppendExpression:
+            {
+                /* Only a local is appended to with a call in the parts, the call cannot change it */
+                std::vector<std::unique_ptr<BoundExpressionNode>*> operands;
+                for(auto& part: static_cast<BoundAppendExpression*>(node.get())->_parts)
+                {
+                    operands.emplace_back(&part);
+                }
+                this->HoistOperands(std::move(operands), statements);
+                return node;
+            }
+            case BoundNodeKind::ConcatExpression:
+            {
+                std::vector<std::unique_ptr<BoundExpressionNode>*> operands;
+                for(auto& part: static_cast<BoundConcatExpression*>(node.get())->_parts)
+                {
+                    operands.emplace_back(&part);
+                }
+                this->HoistOperands(std::move(operands), statements);
+                return node;
+            }
+            default:
+                throw std::logic_error("Lower: Unexpected expression " + __boundNodeStringMap[node->Kind()]);
+        }
+    }
+
+    /*
+     *  Operands are evaluated from left to right. Once a later operand has a hoisted call, an earlier operand has to be
+     *  evaluated before that call too: it is spilled to a temporary unless nothing the call does can change its value
+     * */
+    void Lower::HoistOperands(std::vector<std::unique_ptr<BoundExpressionNode>*> operands, std::vector<std::unique_ptr<BoundStatementNode>>& statements)
+    {
+        /* An append writes its variable like the assignment it was rewritten from */
+        auto isAssignment = [](BoundExpressionNode* node) { return node->Kind() == BoundNodeKind::AssignmentExpression || node->Kind() == BoundNodeKind::AppendExpression; };
+
+        for(auto i = 0; i < operands.size(); i++)
+        {
+            auto& operand = *operands[i];
+            operand = this->HoistExpression(std::move(operand), statements);
+
+            auto callFollows = false;
+            auto assignmentFollows = false;
+            for(auto j = i + 1; j < operands.size(); j++)
+            {
+                callFollows = callFollows || ContainsUserCall(operands[j]->get());
+                assignmentFollows = assignmentFollows || Contains(operands[j]->get(), isAssignment);
+            }
+
+            if(!callFollows)
+            {
+                continue;
+            }
+
+            /* Callees can only reach globals, locals are only changed by an assignment of the statement itself */
+            auto kind = operand->Kind();
+            auto isLocal = kind == BoundNodeKind::VariableExpression && static_cast<BoundVariableExpression*>(operand.get())->_variable->Kind() != SymbolKind::GlobalVariable;
+            if(kind == BoundNodeKind::LiteralExpression || (isLocal && !assignmentFollows))
+            {
+                continue;
+            }
+
+            operand = this->Spill(std::move(operand), statements);
+        }
+    }
+
+    /*
+     *  When the right operand has a call it must only run when the left operand does not decide the result:
+     *      var temporary = left; gotoFalse temporary end {gotoTrue for ||}; var temporary = right; end:
+     * */
+    std::unique_ptr<BoundExpressionNode> Lower::HoistShortCircuitExpression(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements)
+    {
+        auto* expr = static_cast<BoundShortCircuitExpression*>(node.get());
+        expr->_left = this->HoistExpression(std::move(expr->_left), statements);
+
+        if(!ContainsUserCall(expr->_right.get()))
+        {
+            return node;
+        }
+
+        auto temporary = this->GenerateTemporary(expr->Type());
+        auto endLabel = this->GenerateLabel();
+        auto isAnd = expr->_op->_kind == BoundNodeKind::LogicalAnd;
+
+        statements.emplace_back(std::make_unique<BoundVariableDeclaration>(temporary, std::move(expr->_left)));
+        statements.emplace_back(std::make_unique<BoundConditionalGotoStatement>(endLabel, std::make_unique<BoundVariableExpression>(temporary), isAnd));
+        auto right = this->HoistTopExpression(std::move(expr->_right), statements);
+        statements.emplace_back(std::make_unique<BoundVariableDeclaration>(temporary, std::move(right)));
+        statements.emplace_back(std::make_unique<BoundLabelStatement>(endLabel));
+
+        return std::make_unique<BoundVariableExpression>(temporary);
+    }
+
+    /* Evaluates node into a new temporary and returns the read of that temporary */
+    std::unique_ptr<BoundExpressionNode> Lower::Spill(std::unique_ptr<BoundExpressionNode> node, std::vector<std::unique_ptr<BoundStatementNode>>& statements)
+    {
+        auto temporary = this->GenerateTemporary(node->Type());
+        statements.emplace_back(std::make_unique<BoundVariableDeclaration>(temporary, std::move(node)));
+        return std::make_unique<BoundVariableExpression>(temporary);
+    }
+
+    std::unique_ptr<BoundBlockStatement> Lower::RewriteAndFlatten(std::unique_ptr<BoundStatementNode> statement, FunctionSymbol* function, int& variableCount)
     {
         Lower lower;
+        lower._function = function;
+        lower._variableCount = variableCount;
         
         auto loweredStmt = lower.RewriteStatement(std::move(statement));
         auto flattendStmt = lower.Flatten(std::move(loweredStmt));
+        lower.HoistCalls(flattendStmt.get());
+        Lower::Link(flattendStmt.get());
+
+        variableCount += lower._temporaryLimit;
 
         return flattendStmt;
     }
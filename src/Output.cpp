@@ -0,0 +1,228 @@
+#include <codeanalysis/output/Output.hpp>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <unistd.h>
+
+namespace trylang
+{
+    RingBuffer::RingBuffer(std::size_t capacity)
+        : _data(capacity)
+    {}
+
+    std::size_t RingBuffer::Push(const char* data, std::size_t size)
+    {
+        auto head = _head.load(std::memory_order_relaxed);
+        auto tail = _tail.load(std::memory_order_acquire);
+        auto count = std::min(size, _data.size() - (head - tail));
+
+        /* The free space may wrap around the end of _data */
+        auto start = head & (_data.size() - 1);
+        auto first = std::min(count, _data.size() - start);
+        std::memcpy(_data.data() + start, data, first);
+        std::memcpy(_data.data(), data + first, count - first);
+
+        _head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    Output::Output(int fd)
+        : _fd(fd)
+    {}
+
+    Output::~Output()
+    {
+        this->Close();
+    }
+
+    Output& Output::Instance()
+    {
+        static Output output(STDOUT_FILENO);
+        return output;
+    }
+
+    FlushPolicy Output::DefaultPolicy()
+    {
+        return isatty(STDOUT_FILENO) ? FlushPolicy::Line : FlushPolicy::Full;
+    }
+
+    FlushPolicy Output::ParsePolicy(const std::string& name)
+    {
+        if(name == "line")
+        {
+            return FlushPolicy::Line;
+        }
+        if(name == "full")
+        {
+            return FlushPolicy::Full;
+        }
+        if(name == "exit")
+        {
+            return FlushPolicy::Exit;
+        }
+
+        throw std::runtime_error("Unknown flush policy '" + name + "'");
+    }
+
+    void Output::Configure(FlushPolicy policy, bool background)
+    {
+        _policy = policy;
+        _buffer.reserve(BUFFER_SIZE);
+
+        /* Output bypasses the iostreams, the remaining std::cout users are flushed by Flush() */
+        std::ios::sync_with_stdio(false);
+
+        if(background)
+        {
+            _ring = std::make_unique<RingBuffer>(RING_SIZE);
+            _writer = std::thread(&Output::RunWriter, this);
+        }
+    }
+
+    void Output::Write(std::string_view text)
+    {
+        _buffer.append(text);
+
+        if(_policy == FlushPolicy::Full && _buffer.size() >= BUFFER_SIZE)
+        {
+            this->Flush();
+        }
+    }
+
+    void Output::WriteLine(std::string_view text)
+    {
+        _buffer.append(text);
+        this->EndLine();
+    }
+
+    std::size_t Output::WriteValue(const Value& value)
+    {
+        auto size = _buffer.size();
+        auto length = value.TextLength();
+        _buffer.resize(size + length);
+        value.WriteText(_buffer.data() + size, _buffer.data() + _buffer.size());
+        return length;
+    }
+
+    void Output::EndLine()
+    {
+        _buffer.push_back('\n');
+
+        if(_policy == FlushPolicy::Line || (_policy == FlushPolicy::Full && _buffer.size() >= BUFFER_SIZE))
+        {
+            this->Flush();
+        }
+    }
+
+    void Output::Flush()
+    {
+        /* Compiler diagnostics still go through std::cout, they were written before anything pending here */
+        if(_fd == STDOUT_FILENO)
+        {
+            std::cout.flush();
+        }
+
+        if(_buffer.empty())
+        {
+            return;
+        }
+
+        if(_ring == nullptr)
+        {
+            WriteOut(_buffer.data(), _buffer.size());
+            _buffer.clear();
+            return;
+        }
+
+        const char* data = _buffer.data();
+        auto size = _buffer.size();
+        while(size > 0)
+        {
+            auto pushed = _ring->Push(data, size);
+            if(pushed == 0)
+            {
+                std::this_thread::yield(); /* The ring is full, the writer is behind */
+            }
+            data += pushed;
+            size -= pushed;
+        }
+        _buffer.clear();
+    }
+
+    void Output::Close()
+    {
+        this->Flush();
+
+        if(_writer.joinable())
+        {
+            _closing.store(true, std::memory_order_release);
+            _writer.join();
+            _ring.reset();
+        }
+    }
+
+    void Output::RunWriter()
+    {
+        auto& ring = *_ring;
+        auto mask = ring._data.size() - 1;
+        auto idle = 0;
+
+        while(true)
+        {
+            /* _closing is read first, so a head loaded afterwards holds every byte pushed before Close() */
+            auto closing = _closing.load(std::memory_order_acquire);
+            auto head = ring._head.load(std::memory_order_acquire);
+            auto tail = ring._tail.load(std::memory_order_relaxed);
+
+            if(head == tail)
+            {
+                if(closing)
+                {
+                    return;
+                }
+
+                /* Nothing to write, back off to sleeping so that a program waiting on input() does not keep a core busy */
+                if(++idle < 64)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+                continue;
+            }
+
+            idle = 0;
+
+            /* Writes the pending bytes up to the end of _data, the rest is written by the next iteration */
+            auto start = tail & mask;
+            auto count = std::min(head - tail, ring._data.size() - start);
+            WriteOut(ring._data.data() + start, count);
+            ring._tail.store(tail + count, std::memory_order_release);
+        }
+    }
+
+    void Output::WriteOut(const char* data, std::size_t size)
+    {
+        while(size > 0)
+        {
+            auto written = write(_fd, data, size);
+            if(written < 0)
+            {
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+                _error = errno; /* The rest is dropped, FileTable::Close reports the error */
+                return;
+            }
+
+            data += written;
+            size -= written;
+        }
+    }
+}
@@ -3,6 +3,7 @@
 #include <codeanalysis/parser/utils/ExpressionSyntax.hpp>
 #include <codeanalysis/lexer/Lexer.hpp>
 #include <codeanalysis/utils/SyntaxTree.hpp>
+#include <algorithm>
 #include <memory>
 #include <sstream>
 #include <stdexcept>
@@ -18,23 +19,62 @@ namespace trylang
 
     bool Parser::IsAtEnd()
     {
-        return this->Peek(0)->Kind() == SyntaxKind::EndOfFileToken;
+        return this->CurrentKind() == SyntaxKind::EndOfFileToken;
     }
 
-    Parser::Parser(std::vector<std::unique_ptr<SyntaxToken>>&& tokens) : _tokens(std::move(tokens))
+    namespace
+    {
+        /* Hands out the tokens of a TokenStream in order */
+        struct TokenStreamSource : TokenSource
+        {
+            TokenStream _tokens;
+            int _next = 0;
+
+            explicit TokenStreamSource(TokenStream&& tokens) : _tokens(std::move(tokens))
+            {}
+
+            int Fill(Token* tokens, int count) override
+            {
+                int last = static_cast<int>(_tokens.Size()) - 1; /* The EndOfFileToken */
+                for(auto index = 0; index < count; index++)
+                {
+                    tokens[index] = _tokens.Take(_next < last ? _next++ : last);
+                }
+                return count;
+            }
+        };
+    }
+
+    Parser::Parser(TokenSource& source, std::string_view text) : _source(source)
     {
-        _tokens_size = _tokens.size();
         _buffer.str("");
-        _current = 0;
+        _tokens._source = text;
         _statements = std::vector<std::unique_ptr<StatementSyntax>>();
     }
 
-    std::unique_ptr<CompilationUnitSyntax> Parser::AST(std::vector<std::unique_ptr<SyntaxToken>>&& tokens)
+    std::unique_ptr<CompilationUnitSyntax> Parser::AST(std::string_view text)
     {
-        Parser parser(std::move(tokens));
+        Lexer lexer(text);
+        Parser parser(lexer, text);
 
         std::unique_ptr<CompilationUnitSyntax> compilationSyntax = parser.Parse();
-        
+
+        /* The text has been lexed as far as the Parser went, which is to the end */
+        Lexer::PrintErrors();
+        return Parser::Report(std::move(compilationSyntax));
+    }
+
+    std::unique_ptr<CompilationUnitSyntax> Parser::AST(TokenStream&& tokens)
+    {
+        auto text = tokens._source;
+        TokenStreamSource source(std::move(tokens));
+        Parser parser(source, text);
+
+        return Parser::Report(parser.Parse());
+    }
+
+    std::unique_ptr<CompilationUnitSyntax> Parser::Report(std::unique_ptr<CompilationUnitSyntax> compilationSyntax)
+    {
         if(!Parser::Errors().empty())
         {
             std::cout << "Parsing Errors Reported:\n";
@@ -45,29 +85,64 @@ namespace trylang
         return compilationSyntax;
     }
 
-    SyntaxToken* Parser::Peek(int offset)
+    Token& Parser::Peek(int offset)
+    {
+        if(_count <= offset)
+        {
+            this->Pull(offset);
+        }
+
+        return _lookahead[_head + offset];
+    }
+
+    /* The tokens not consumed yet move to the front of _lookahead, the rest of it is filled from _source */
+    void Parser::Pull(int offset)
     {
-        int index = _current + offset;
-        if(index >= _tokens_size)
+        if(offset >= LOOKAHEAD)
         {
-            return _tokens[_tokens_size - 1].get();
+            throw std::logic_error("Parser: Peek past the lookahead");
         }
 
-        return _tokens[index].get();
+        std::move(_lookahead.begin() + _head, _lookahead.begin() + _head + _count, _lookahead.begin());
+        _head = 0;
+        while(_count <= offset)
+        {
+            _count += _source.Fill(_lookahead.data() + _count, LOOKAHEAD - _count);
+        }
     }
 
-    SyntaxToken* Parser::Current()
+    Token& Parser::Current()
     {
         return this->Peek(0);
     }
 
-    std::unique_ptr<SyntaxToken> Parser::Advance()
+    SyntaxKind Parser::PeekKind(int offset)
+    {
+        return this->Peek(offset)._kind;
+    }
+
+    SyntaxKind Parser::CurrentKind()
+    {
+        return this->PeekKind(0);
+    }
+
+    /* Consumes the current token, which a syntax node refers to by the returned index */
+    int Parser::Advance()
     {
-        _current++;
-        return std::move(_tokens.at(_current - 1));
+        _tokens.Add(this->Current());
+        this->Skip();
+        return static_cast<int>(_tokens.Size()) - 1;
     }
 
-    std::unique_ptr<SyntaxToken> Parser::Consume(SyntaxKind kind, std::string message)
+    /* Consumes the current token without keeping it */
+    void Parser::Skip()
+    {
+        (void)this->Current();
+        _head++;
+        _count--;
+    }
+
+    int Parser::Consume(SyntaxKind kind, std::string message)
     {
         if(this->Check(kind))
         {
@@ -76,18 +151,29 @@ namespace trylang
 
         this->Error(this->Current(), message);
 
-        return nullptr; // Unreachable
+        return -1; // Unreachable
+    }
+
+    void Parser::Expect(SyntaxKind kind, std::string message)
+    {
+        if(this->Check(kind))
+        {
+            this->Skip();
+            return;
+        }
+
+        this->Error(this->Current(), message);
     }
 
-    void Parser::Error(SyntaxToken* token, std::string message)
+    void Parser::Error(const Token& token, std::string message)
     {
-        if(token->Kind() == SyntaxKind::EndOfFileToken)
+        if(token._kind == SyntaxKind::EndOfFileToken)
         {
-            this->GenerateError(token->_line, " at end: " + message + " | Instead got " + trylang::__syntaxStringMap[this->Current()->Kind()]);
+            this->GenerateError(token._line, " at end: " + message + " | Instead got " + trylang::__syntaxStringMap[this->CurrentKind()]);
         }
         else
         {
-            this->GenerateError(token->_line, " at '" + token->_text + "' " + message + " | Instead got " + trylang::__syntaxStringMap[this->Current()->Kind()]);
+            this->GenerateError(token._line, " at '" + std::string(_tokens._source.substr(token._offset, token._length)) + "' " + message + " | Instead got " + trylang::__syntaxStringMap[this->CurrentKind()]);
         }
 
         throw std::runtime_error("Throwing Exception In Parsing.");
@@ -105,7 +191,7 @@ namespace trylang
             return false;
         }
 
-        return this->Peek(0)->Kind() == kind;
+        return this->CurrentKind() == kind;
     }
 
     std::unique_ptr<CompilationUnitSyntax> Parser::Parse()
@@ -115,14 +201,14 @@ namespace trylang
             _statements.emplace_back(this->ParseDeclaration());
         }
 
-        return std::make_unique<CompilationUnitSyntax>(std::move(_statements));
+        return std::make_unique<CompilationUnitSyntax>(std::move(_statements), std::move(_tokens));
     }
 
     std::unique_ptr<StatementSyntax> Parser::ParseDeclaration()
     {
         try
         {
-            if(this->Current()->Kind() == SyntaxKind::FunctionKeyword)
+            if(this->CurrentKind() == SyntaxKind::FunctionKeyword)
             {
                 return this->ParseFunctionDeclarationStatement();
             }
@@ -147,21 +233,21 @@ namespace trylang
         auto typeClause = this->ParseOptionalTypeClause(); /* return type of the function */
         auto body = this->ParseBlockStatement(true);
 
-        return std::make_unique<FunctionDeclarationStatementSyntax>(std::move(functionKeyword), std::move(identifier), std::move(openParenthesis), std::move(parameters), std::move(closeParenthesis), std::move(typeClause), std::move(body));
+        return std::make_unique<FunctionDeclarationStatementSyntax>(functionKeyword, identifier, openParenthesis, std::move(parameters), closeParenthesis, std::move(typeClause), std::move(body));
     }
 
     std::vector<std::unique_ptr<ParameterSyntax>> Parser::ParseParameterList()
     {
         std::vector<std::unique_ptr<ParameterSyntax>> parameters;
 
-        while(this->Current()->Kind() != SyntaxKind::CloseParenthesisToken && this->Current()->Kind() != SyntaxKind::EndOfFileToken)
+        while(this->CurrentKind() != SyntaxKind::CloseParenthesisToken && this->CurrentKind() != SyntaxKind::EndOfFileToken)
         {
             auto parameter = this->ParseParameter();
             parameters.emplace_back(std::move(parameter));
 
-            if(this->Current()->Kind() != SyntaxKind::CloseParenthesisToken)
+            if(this->CurrentKind() != SyntaxKind::CloseParenthesisToken)
             {
-                auto commaToken = this->Consume(SyntaxKind::CommaToken, "Expected a ','.");
+                this->Expect(SyntaxKind::CommaToken, "Expected a ','.");
                 // parameters.emplace_back(std::move(commaToken));
             }
         }
@@ -173,26 +259,26 @@ namespace trylang
     {
         auto identifier = this->Consume(SyntaxKind::IdentifierToken, "Expected a parameter name");
         auto typeClause = this->ParseTypeClause(); /* typeClause is not optional */
-        return std::make_unique<ParameterSyntax>(std::move(identifier), std::move(typeClause));
+        return std::make_unique<ParameterSyntax>(identifier, std::move(typeClause));
     }
 
     std::unique_ptr<StatementSyntax> Parser::ParseVariableDeclarationStatement()
     {
-        auto expected = this->Current()->Kind() == SyntaxKind::VarKeyword ? SyntaxKind::VarKeyword : SyntaxKind::LetKeyword;
+        auto expected = this->CurrentKind() == SyntaxKind::VarKeyword ? SyntaxKind::VarKeyword : SyntaxKind::LetKeyword;
         auto keyword = this->Consume(expected, "Expected 'var' or 'let'.");
         auto identifier = this->Consume(SyntaxKind::IdentifierToken, "Expected a variable name.");
         auto typeClause = this->ParseOptionalTypeClause();
         auto equalsToken = this->Consume(SyntaxKind::EqualsToken, "Expected a '='.");
         auto initializer = this->ParseExpression();
 
-        (void)this->Consume(SyntaxKind::SemicolonToken, "Expected a ';'.");
+        this->Expect(SyntaxKind::SemicolonToken, "Expected a ';'.");
 
-        return std::make_unique<VariableDeclarationStatementSyntax>(std::move(keyword), std::move(identifier), std::move(typeClause) ,std::move(equalsToken), std::move(initializer));
+        return std::make_unique<VariableDeclarationStatementSyntax>(keyword, identifier, std::move(typeClause) ,equalsToken, std::move(initializer));
     }
 
     std::unique_ptr<TypeClauseSyntax> Parser::ParseOptionalTypeClause()
     {
-        if(this->Current()->Kind() != SyntaxKind::ColonToken)
+        if(this->CurrentKind() != SyntaxKind::ColonToken)
         {
             return nullptr;
         }
@@ -204,15 +290,15 @@ namespace trylang
         auto colonToken = this->Consume(SyntaxKind::ColonToken, "Expected ':' here.");
         auto identifierToken = this->Consume(SyntaxKind::IdentifierToken, "Expected a type name.");
 
-        return std::make_unique<TypeClauseSyntax>(std::move(colonToken), std::move(identifierToken));
+        return std::make_unique<TypeClauseSyntax>(colonToken, identifierToken);
     }
 
     void Parser::SynchronizeAfterAnExpectionForInvalidTokenMatch()
     {
-        _current++; /* Advance to NextToken */
-        while(this->Current()->Kind() != SyntaxKind::EndOfFileToken)
+        this->Skip(); /* Advance to NextToken */
+        while(this->CurrentKind() != SyntaxKind::EndOfFileToken)
         {
-            if(this->Current()->Kind() == SyntaxKind::SemicolonToken)
+            if(this->CurrentKind() == SyntaxKind::SemicolonToken)
             {
                 /* 
                     We have reached the end of the statement which caused an exception. 
@@ -221,13 +307,13 @@ namespace trylang
                 return;
             }
 
-            _current++; /* Advance to NextToken */
+            this->Skip(); /* Advance to NextToken */
         }
     }
 
     std::unique_ptr<StatementSyntax> Parser::ParseStatement()
     {
-        switch (this->Current()->Kind())
+        switch (this->CurrentKind())
         {
             case SyntaxKind::OpenBraceToken: return this->ParseBlockStatement(); break;
             case SyntaxKind::IfKeyword: return this->ParseIfStatement(); break;
@@ -246,18 +332,18 @@ namespace trylang
     std::unique_ptr<StatementSyntax> Parser::ParseIfStatement()
     {
         auto keyword = this->Consume(SyntaxKind::IfKeyword, "Expected 'If' keyword.");
-        (void)this->Consume(SyntaxKind::OpenParenthesisToken, "Expected a '('.");
+        this->Expect(SyntaxKind::OpenParenthesisToken, "Expected a '('.");
         auto condition = this->ParseExpression();
-        (void)this->Consume(SyntaxKind::CloseParenthesisToken, "Expected a ')'.");
+        this->Expect(SyntaxKind::CloseParenthesisToken, "Expected a ')'.");
         auto statement = this->ParseStatement();
         auto elseClause = this->ParseElseClause();
 
-        return std::make_unique<IfStatementSyntax>(std::move(keyword), std::move(condition), std::move(statement), std::move(elseClause));
+        return std::make_unique<IfStatementSyntax>(keyword, std::move(condition), std::move(statement), std::move(elseClause));
     }
 
     std::unique_ptr<StatementSyntax> Parser::ParseElseClause()
     {
-        if(this->Current()->Kind() != SyntaxKind::ElseKeyword)
+        if(this->CurrentKind() != SyntaxKind::ElseKeyword)
         {
             return nullptr;
         }
@@ -265,7 +351,7 @@ namespace trylang
         auto keyword = this->Consume(SyntaxKind::ElseKeyword, "Expected 'else' keyword.");
         auto statement = this->ParseStatement();
 
-        return std::make_unique<ElseStatementSyntax>(std::move(keyword), std::move(statement));
+        return std::make_unique<ElseStatementSyntax>(keyword, std::move(statement));
     }
 
 
@@ -275,8 +361,8 @@ namespace trylang
 
         auto openBraceToken = this->Consume(SyntaxKind::OpenBraceToken, "Expected '{'.");
 
-        /* !(this->Current()->Kind() == SyntaxKind::EndOfFileToken || this->Current()->Kind() == SyntaxKind::CloseBraceToken) */
-        while(this->Current()->Kind() != SyntaxKind::EndOfFileToken && this->Current()->Kind() != SyntaxKind::CloseBraceToken)
+        /* !(this->CurrentKind() == SyntaxKind::EndOfFileToken || this->CurrentKind() == SyntaxKind::CloseBraceToken) */
+        while(this->CurrentKind() != SyntaxKind::EndOfFileToken && this->CurrentKind() != SyntaxKind::CloseBraceToken)
         {
             auto statement = this->ParseStatement();
             statements.emplace_back(std::move(statement));
@@ -289,13 +375,13 @@ namespace trylang
 
         auto closeBraceToken = this->Consume(SyntaxKind::CloseBraceToken, "Expected '}'.");
 
-        return std::make_unique<BlockStatementSyntax>(std::move(openBraceToken), std::move(statements), std::move(closeBraceToken));
+        return std::make_unique<BlockStatementSyntax>(openBraceToken, std::move(statements), closeBraceToken);
     }
 
     std::unique_ptr<StatementSyntax> Parser::ParseExpressionStatement()
     {
         auto expression = this->ParseExpression();
-        (void)this->Consume(SyntaxKind::SemicolonToken, "Expected a ';'.");
+        this->Expect(SyntaxKind::SemicolonToken, "Expected a ';'.");
         return std::make_unique<ExpressionStatementSyntax>(std::move(expression));
     }
 
@@ -307,13 +393,13 @@ namespace trylang
     /* This will take care of `a = b = 5` */
     std::unique_ptr<ExpressionSyntax> Parser::ParseAssignmentExpression()
     {
-        if(this->Peek(0)->Kind() == SyntaxKind::IdentifierToken && this->Peek(1)->Kind() == SyntaxKind::EqualsToken)
+        if(this->PeekKind(0) == SyntaxKind::IdentifierToken && this->PeekKind(1) == SyntaxKind::EqualsToken)
         {
             auto identifierToken = this->Advance();
             auto operatorToken = this->Advance();
             auto right = this->ParseAssignmentExpression();
 
-            return std::make_unique<AssignmentExpressionSyntax>(std::move(identifierToken), std::move(operatorToken), std::move(right));
+            return std::make_unique<AssignmentExpressionSyntax>(identifierToken, operatorToken, std::move(right));
         }
 
         return this->ParseLogicalOrExpression();
@@ -323,12 +409,12 @@ namespace trylang
     {
         auto expr = this->ParseLogicalAndExpression();
 
-        while(this->Current()->Kind() == SyntaxKind::PipePipeToken)
+        while(this->CurrentKind() == SyntaxKind::PipePipeToken)
         {
             auto op = this->Advance();
             auto right = this->ParseLogicalAndExpression();
 
-            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), std::move(op), std::move(right));
+            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), op, std::move(right));
         }
 
         return expr;
@@ -338,12 +424,12 @@ namespace trylang
     {
         auto expr = this->ParseEqualityExpression();
 
-        while(this->Current()->Kind() == SyntaxKind::AmpersandAmpersandToken)
+        while(this->CurrentKind() == SyntaxKind::AmpersandAmpersandToken)
         {
             auto op = this->Advance();
             auto right = this->ParseEqualityExpression();
 
-            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), std::move(op), std::move(right));
+            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), op, std::move(right));
         }
 
         return expr;
@@ -353,12 +439,12 @@ namespace trylang
     {
         auto expr = this->ParseComparisonExpression();
         
-        while(this->Current()->Kind() == SyntaxKind::BangsEqualsToken || this->Current()->Kind() == SyntaxKind::EqualsEqualsToken)
+        while(this->CurrentKind() == SyntaxKind::BangsEqualsToken || this->CurrentKind() == SyntaxKind::EqualsEqualsToken)
         {
             auto op = this->Advance();
             auto right = this->ParseComparisonExpression();
 
-            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), std::move(op), std::move(right));
+            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), op, std::move(right));
         }
 
         return expr;
@@ -368,12 +454,12 @@ namespace trylang
     {
         auto expr = this->ParseTermExpression();
         
-        while(this->Current()->Kind() == SyntaxKind::GreaterThanToken || this->Current()->Kind() == SyntaxKind::GreaterThanEqualsToken || this->Current()->Kind() == SyntaxKind::LessThanToken || this->Current()->Kind() == SyntaxKind::LessThanEqualsToken)
+        while(this->CurrentKind() == SyntaxKind::GreaterThanToken || this->CurrentKind() == SyntaxKind::GreaterThanEqualsToken || this->CurrentKind() == SyntaxKind::LessThanToken || this->CurrentKind() == SyntaxKind::LessThanEqualsToken)
         {
             auto op = this->Advance();
             auto right = this->ParseTermExpression();
 
-            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), std::move(op), std::move(right));
+            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), op, std::move(right));
         }
 
         return expr;
@@ -383,12 +469,12 @@ namespace trylang
     {
         auto expr = this->ParseFactorExpression();
         
-        while(this->Current()->Kind() == SyntaxKind::PlusToken || this->Current()->Kind() == SyntaxKind::MinusToken)
+        while(this->CurrentKind() == SyntaxKind::PlusToken || this->CurrentKind() == SyntaxKind::MinusToken)
         {
             auto op = this->Advance();
             auto right = this->ParseFactorExpression();
 
-            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), std::move(op), std::move(right));
+            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), op, std::move(right));
         }
 
         return expr;
@@ -398,12 +484,12 @@ namespace trylang
     {
         auto expr = this->ParseUnaryExpression();
         
-        while(this->Current()->Kind() == SyntaxKind::StarToken || this->Current()->Kind() == SyntaxKind::SlashToken)
+        while(this->CurrentKind() == SyntaxKind::StarToken || this->CurrentKind() == SyntaxKind::SlashToken)
         {
             auto op = this->Advance();
             auto right = this->ParseUnaryExpression();
 
-            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), std::move(op), std::move(right));
+            expr = std::make_unique<BinaryExpressionSyntax>(std::move(expr), op, std::move(right));
         }
 
         return expr;
@@ -411,12 +497,12 @@ namespace trylang
 
     std::unique_ptr<ExpressionSyntax> Parser::ParseUnaryExpression()
     {
-        if(this->Current()->Kind() == SyntaxKind::BangToken || this->Current()->Kind() == SyntaxKind::PlusToken || this->Current()->Kind() == SyntaxKind::MinusToken)
+        if(this->CurrentKind() == SyntaxKind::BangToken || this->CurrentKind() == SyntaxKind::PlusToken || this->CurrentKind() == SyntaxKind::MinusToken)
         {
             auto op = this->Advance();
             auto right = this->ParseUnaryExpression();
 
-            return std::make_unique<UnaryExpressionSyntax>(std::move(op), std::move(right));
+            return std::make_unique<UnaryExpressionSyntax>(op, std::move(right));
         }
 
         return this->ParsePrimaryExpression();
@@ -429,33 +515,33 @@ namespace trylang
 
         std::vector<std::unique_ptr<ExpressionSyntax>> arguments;
         
-        while(this->Current()->Kind() != SyntaxKind::CloseParenthesisToken && this->Current()->Kind() != SyntaxKind::EndOfFileToken)
+        while(this->CurrentKind() != SyntaxKind::CloseParenthesisToken && this->CurrentKind() != SyntaxKind::EndOfFileToken)
         {
             auto expression = this->ParseExpression();
             arguments.emplace_back(std::move(expression));
 
-            if(this->Current()->Kind() != SyntaxKind::CloseParenthesisToken)
+            if(this->CurrentKind() != SyntaxKind::CloseParenthesisToken)
             {
-                auto commaToken = this->Consume(SyntaxKind::CommaToken, "Expected ','.");
+                this->Expect(SyntaxKind::CommaToken, "Expected ','.");
                 /* arguments.emplace_back(std::move(commaToken)); */
             }
         }
 
         auto closeParenthesis = this->Consume(SyntaxKind::CloseParenthesisToken, "Expected ')'.");
 
-        return std::make_unique<CallExpressionSyntax>(std::move(identifierToken), std::move(openParenthesis), std::move(arguments), std::move(closeParenthesis));
+        return std::make_unique<CallExpressionSyntax>(identifierToken, openParenthesis, std::move(arguments), closeParenthesis);
         
     }
 
     std::unique_ptr<ExpressionSyntax> Parser::ParsePrimaryExpression()
     {
-        switch (this->Current()->Kind())
+        switch (this->CurrentKind())
         {
             case SyntaxKind::OpenParenthesisToken:
                 return this->ParseParenthesizedExpression();
                 break;
             case SyntaxKind::IdentifierToken:
-                if(this->Peek(1)->Kind() == SyntaxKind::OpenParenthesisToken)
+                if(this->PeekKind(1) == SyntaxKind::OpenParenthesisToken)
                 {
                     return this->ParseCallExpression();
                 }
@@ -479,32 +565,34 @@ namespace trylang
         auto expression = this->ParseExpression();
         auto closeParenthesisToken = this->Consume(SyntaxKind::CloseParenthesisToken, "Expected ')'.");
 
-        return std::make_unique<ParenthesizedExpressionSyntax>(std::move(openParenthesisToken), std::move(expression), std::move(closeParenthesisToken));
+        return std::make_unique<ParenthesizedExpressionSyntax>(openParenthesisToken, std::move(expression), closeParenthesisToken);
     }
 
     std::unique_ptr<ExpressionSyntax> Parser::ParseNameExpression()
     {
         auto identifierToken = this->Advance();
-        return std::make_unique<NameExpressionSyntax>(std::move(identifierToken));
+        return std::make_unique<NameExpressionSyntax>(identifierToken);
     }
 
     std::unique_ptr<ExpressionSyntax> Parser::ParseLiteralExpression()
     {
-        if(this->Current()->Kind() == SyntaxKind::TrueKeyword || this->Current()->Kind() == SyntaxKind::FalseKeyword)
+        if(this->CurrentKind() == SyntaxKind::TrueKeyword || this->CurrentKind() == SyntaxKind::FalseKeyword)
         {
             auto keywordToken = this->Advance();
-            auto value = keywordToken->Kind() == SyntaxKind::TrueKeyword;
-            return std::make_unique<LiteralExpressionSyntax>(std::move(keywordToken), value);
+            auto value = _tokens.Kind(keywordToken) == SyntaxKind::TrueKeyword;
+            return std::make_unique<LiteralExpressionSyntax>(keywordToken, value);
         }
-        else if(this->Current()->Kind() == SyntaxKind::StringToken)
+        else if(this->CurrentKind() == SyntaxKind::StringToken)
         {
+            auto value = std::move(this->Current()._value);
             auto stringToken = this->Advance();
-            return std::make_unique<LiteralExpressionSyntax>(std::move(stringToken));
+            return std::make_unique<LiteralExpressionSyntax>(stringToken, std::move(value));
         }
         else
         {
+            auto value = std::move(this->Current()._value);
             auto numberToken = this->Consume(SyntaxKind::NumberToken, "Expected a number.");
-            return std::make_unique<LiteralExpressionSyntax>(std::move(numberToken));
+            return std::make_unique<LiteralExpressionSyntax>(numberToken, std::move(value));
         }
     }
 
@@ -556,27 +644,27 @@ namespace trylang
     std::unique_ptr<StatementSyntax> Parser::ParseWhileStatement()
     {
         auto keyword = this->Advance();
-        (void)this->Consume(SyntaxKind::OpenParenthesisToken, "Expected a '('.");
+        this->Expect(SyntaxKind::OpenParenthesisToken, "Expected a '('.");
         auto condition = this->ParseExpression();
-        (void)this->Consume(SyntaxKind::CloseParenthesisToken, "Expected a ')'.");
+        this->Expect(SyntaxKind::CloseParenthesisToken, "Expected a ')'.");
         auto body = this->ParseStatement();
 
-        return std::make_unique<WhileStatementSyntax>(std::move(keyword), std::move(condition), std::move(body));
+        return std::make_unique<WhileStatementSyntax>(keyword, std::move(condition), std::move(body));
 
     }
 
     std::unique_ptr<StatementSyntax> Parser::ParseBreakStatement()
     {
         auto keyword = this->Advance();
-        (void)this->Consume(SyntaxKind::SemicolonToken, "Expected a ';'.");
-        return std::make_unique<BreakStatementSyntax>(std::move(keyword));
+        this->Expect(SyntaxKind::SemicolonToken, "Expected a ';'.");
+        return std::make_unique<BreakStatementSyntax>(keyword);
     }
 
     std::unique_ptr<StatementSyntax> Parser::ParseContinueStatement()
     {
         auto keyword = this->Advance();
-        (void)this->Consume(SyntaxKind::SemicolonToken, "Expected a ';'.");
-        return std::make_unique<ContinueStatementSyntax>(std::move(keyword));
+        this->Expect(SyntaxKind::SemicolonToken, "Expected a ';'.");
+        return std::make_unique<ContinueStatementSyntax>(keyword);
     }
 
     /* Every return statement must have an expression */
@@ -584,7 +672,7 @@ namespace trylang
     {
         auto keyword = this->Advance();
         std::unique_ptr<ExpressionSyntax> expression = this->ParseExpression();
-        (void)this->Consume(SyntaxKind::SemicolonToken, "Expected a ';'.");
-        return std::make_unique<ReturnStatementSyntax>(std::move(keyword), std::move(expression));
+        this->Expect(SyntaxKind::SemicolonToken, "Expected a ';'.");
+        return std::make_unique<ReturnStatementSyntax>(keyword, std::move(expression));
     }
 }
\ No newline at end of file
@@ -0,0 +1,283 @@
+#include <codeanalysis/lexer/Scanner.hpp>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) && defined(__GNUC__)
+#define TRYLANG_AVX2 1
+#endif
+
+namespace trylang
+{
+    namespace
+    {
+        const char* ScalarWhitespace(const char* first, const char* last, int& newlines)
+        {
+            for(; first != last; first++)
+            {
+                if(*first == '\n')
+                {
+                    newlines++;
+                }
+                else if(*first != ' ' && *first != '\t' && *first != '\r')
+                {
+                    break;
+                }
+            }
+            return first;
+        }
+
+        const char* ScalarUntil(const char* first, const char* last, char stop, int& newlines)
+        {
+            for(; first != last && *first != stop; first++)
+            {
+                if(*first == '\n')
+                {
+                    newlines++;
+                }
+            }
+            return first;
+        }
+
+        const char* ScalarIdentifier(const char* first, const char* last)
+        {
+            while(first != last && IsAlphaNumeric(*first))
+            {
+                first++;
+            }
+            return first;
+        }
+
+        const char* ScalarDigits(const char* first, const char* last)
+        {
+            while(first != last && IsDigit(*first))
+            {
+                first++;
+            }
+            return first;
+        }
+
+        /*
+         *  Every SIMD version builds a mask with one bit per character that belongs to the run. The first zero bit is
+         *  where the run stops, newlines are the '\n' bits before it
+         * */
+#if defined(__SSE2__)
+        constexpr int SSE2_WIDTH = 16;
+
+        /* lower < ch < upper, compares are signed so characters above 0x7F are never inside */
+        inline __m128i Sse2Between(__m128i block, char lower, char upper)
+        {
+            return _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8(lower)), _mm_cmpgt_epi8(_mm_set1_epi8(upper), block));
+        }
+
+        inline __m128i Sse2Load(const char* first)
+        {
+            return _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+        }
+
+        const char* Sse2Whitespace(const char* first, const char* last, int& newlines)
+        {
+            while(last - first >= SSE2_WIDTH)
+            {
+                auto block = Sse2Load(first);
+                auto newline = _mm_cmpeq_epi8(block, _mm_set1_epi8('\n'));
+                auto blank = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8(' ')), _mm_cmpeq_epi8(block, _mm_set1_epi8('\t'))),
+                                          _mm_or_si128(_mm_cmpeq_epi8(block, _mm_set1_epi8('\r')), newline));
+                unsigned lines = _mm_movemask_epi8(newline);
+                unsigned stop = ~static_cast<unsigned>(_mm_movemask_epi8(blank)) & 0xFFFFu;
+                if(stop != 0)
+                {
+                    auto index = __builtin_ctz(stop);
+                    newlines += __builtin_popcount(lines & ((1u << index) - 1));
+                    return first + index;
+                }
+                newlines += __builtin_popcount(lines);
+                first += SSE2_WIDTH;
+            }
+            return ScalarWhitespace(first, last, newlines);
+        }
+
+        const char* Sse2Until(const char* first, const char* last, char stop, int& newlines)
+        {
+            while(last - first >= SSE2_WIDTH)
+            {
+                auto block = Sse2Load(first);
+                unsigned lines = _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8('\n')));
+                unsigned found = _mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(stop)));
+                if(found != 0)
+                {
+                    auto index = __builtin_ctz(found);
+                    newlines += __builtin_popcount(lines & ((1u << index) - 1));
+                    return first + index;
+                }
+                newlines += __builtin_popcount(lines);
+                first += SSE2_WIDTH;
+            }
+            return ScalarUntil(first, last, stop, newlines);
+        }
+
+        const char* Sse2Identifier(const char* first, const char* last)
+        {
+            while(last - first >= SSE2_WIDTH)
+            {
+                auto block = Sse2Load(first);
+                auto lower = _mm_or_si128(block, _mm_set1_epi8(0x20));
+                auto alphaNumeric = _mm_or_si128(Sse2Between(block, '0' - 1, '9' + 1), Sse2Between(lower, 'a' - 1, 'z' + 1));
+                unsigned stop = ~static_cast<unsigned>(_mm_movemask_epi8(alphaNumeric)) & 0xFFFFu;
+                if(stop != 0)
+                {
+                    return first + __builtin_ctz(stop);
+                }
+                first += SSE2_WIDTH;
+            }
+            return ScalarIdentifier(first, last);
+        }
+
+        const char* Sse2Digits(const char* first, const char* last)
+        {
+            while(last - first >= SSE2_WIDTH)
+            {
+                unsigned stop = ~static_cast<unsigned>(_mm_movemask_epi8(Sse2Between(Sse2Load(first), '0' - 1, '9' + 1))) & 0xFFFFu;
+                if(stop != 0)
+                {
+                    return first + __builtin_ctz(stop);
+                }
+                first += SSE2_WIDTH;
+            }
+            return ScalarDigits(first, last);
+        }
+#endif
+
+#if defined(TRYLANG_AVX2)
+        /* Compiled for AVX2 whatever the target of the build, only called once the CPU has been checked */
+        constexpr int AVX2_WIDTH = 32;
+
+        __attribute__((target("avx2"))) inline __m256i Avx2Between(__m256i block, char lower, char upper)
+        {
+            return _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8(lower)), _mm256_cmpgt_epi8(_mm256_set1_epi8(upper), block));
+        }
+
+        __attribute__((target("avx2"))) inline __m256i Avx2Load(const char* first)
+        {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        }
+
+        __attribute__((target("avx2"))) const char* Avx2Whitespace(const char* first, const char* last, int& newlines)
+        {
+            while(last - first >= AVX2_WIDTH)
+            {
+                auto block = Avx2Load(first);
+                auto newline = _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'));
+                auto blank = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(' ')), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('\t'))),
+                                             _mm256_or_si256(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\r')), newline));
+                auto lines = static_cast<unsigned>(_mm256_movemask_epi8(newline));
+                auto stop = ~static_cast<unsigned>(_mm256_movemask_epi8(blank));
+                if(stop != 0)
+                {
+                    auto index = __builtin_ctz(stop);
+                    newlines += __builtin_popcount(index == 0 ? 0 : lines & (~0u >> (32 - index)));
+                    return first + index;
+                }
+                newlines += __builtin_popcount(lines);
+                first += AVX2_WIDTH;
+            }
+            return ScalarWhitespace(first, last, newlines);
+        }
+
+        __attribute__((target("avx2"))) const char* Avx2Until(const char* first, const char* last, char stop, int& newlines)
+        {
+            while(last - first >= AVX2_WIDTH)
+            {
+                auto block = Avx2Load(first);
+                auto lines = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8('\n'))));
+                auto found = static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8(stop))));
+                if(found != 0)
+                {
+                    auto index = __builtin_ctz(found);
+                    newlines += __builtin_popcount(index == 0 ? 0 : lines & (~0u >> (32 - index)));
+                    return first + index;
+                }
+                newlines += __builtin_popcount(lines);
+                first += AVX2_WIDTH;
+            }
+            return ScalarUntil(first, last, stop, newlines);
+        }
+
+        __attribute__((target("avx2"))) const char* Avx2Identifier(const char* first, const char* last)
+        {
+            while(last - first >= AVX2_WIDTH)
+            {
+                auto block = Avx2Load(first);
+                auto lower = _mm256_or_si256(block, _mm256_set1_epi8(0x20));
+                auto alphaNumeric = _mm256_or_si256(Avx2Between(block, '0' - 1, '9' + 1), Avx2Between(lower, 'a' - 1, 'z' + 1));
+                auto stop = ~static_cast<unsigned>(_mm256_movemask_epi8(alphaNumeric));
+                if(stop != 0)
+                {
+                    return first + __builtin_ctz(stop);
+                }
+                first += AVX2_WIDTH;
+            }
+            return ScalarIdentifier(first, last);
+        }
+
+        __attribute__((target("avx2"))) const char* Avx2Digits(const char* first, const char* last)
+        {
+            while(last - first >= AVX2_WIDTH)
+            {
+                auto stop = ~static_cast<unsigned>(_mm256_movemask_epi8(Avx2Between(Avx2Load(first), '0' - 1, '9' + 1)));
+                if(stop != 0)
+                {
+                    return first + __builtin_ctz(stop);
+                }
+                first += AVX2_WIDTH;
+            }
+            return ScalarDigits(first, last);
+        }
+#endif
+
+        const Scanner SCALAR{"scalar", ScalarWhitespace, ScalarUntil, ScalarIdentifier, ScalarDigits};
+#if defined(__SSE2__)
+        const Scanner SSE2{"sse2", Sse2Whitespace, Sse2Until, Sse2Identifier, Sse2Digits};
+#endif
+#if defined(TRYLANG_AVX2)
+        const Scanner AVX2{"avx2", Avx2Whitespace, Avx2Until, Avx2Identifier, Avx2Digits};
+#endif
+    }
+
+    const Scanner* Scanner::Find(std::string_view name)
+    {
+        if(name == SCALAR._name)
+        {
+            return &SCALAR;
+        }
+#if defined(__SSE2__)
+        if(name == SSE2._name)
+        {
+            return &SSE2;
+        }
+#endif
+#if defined(TRYLANG_AVX2)
+        if(name == AVX2._name && __builtin_cpu_supports("avx2"))
+        {
+            return &AVX2;
+        }
+#endif
+        return nullptr;
+    }
+
+    const Scanner& Scanner::Instance()
+    {
+        static const Scanner* scanner = [] {
+            for(auto name: {"avx2", "sse2"})
+            {
+                if(auto* found = Scanner::Find(name))
+                {
+                    return found;
+                }
+            }
+            return &SCALAR;
+        }();
+        return *scanner;
+    }
+}
@@ -0,0 +1,75 @@
+#include <codeanalysis/lexer/SourceText.hpp>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace trylang
+{
+    SourceText::~SourceText()
+    {
+        if(_mapping != nullptr)
+        {
+            munmap(_mapping, _mappingSize);
+        }
+    }
+
+    std::unique_ptr<SourceText> SourceText::Load(const std::string& path)
+    {
+        auto fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if(fd < 0)
+        {
+            throw std::runtime_error("Not able to open file");
+        }
+
+        auto source = std::make_unique<SourceText>();
+
+        struct stat status{};
+        if(fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+        {
+            auto* mapping = mmap(nullptr, status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if(mapping != MAP_FAILED)
+            {
+                /* The mapping stays valid once fd is closed */
+                close(fd);
+                madvise(mapping, status.st_size, MADV_SEQUENTIAL);
+                source->_mapping = mapping;
+                source->_mappingSize = status.st_size;
+                source->_text = std::string_view(static_cast<const char*>(mapping), status.st_size);
+                return source;
+            }
+        }
+
+        /* Pipes and files which cannot be mapped are read whole */
+        char block[1 << 16];
+        while(true)
+        {
+            auto count = read(fd, block, sizeof block);
+            if(count < 0 && errno == EINTR)
+            {
+                continue;
+            }
+
+            if(count < 0)
+            {
+                auto error = errno;
+                close(fd);
+                throw std::runtime_error("Failed to read '" + path + "': " + std::strerror(error));
+            }
+
+            if(count == 0)
+            {
+                break;
+            }
+
+            source->_copy.append(block, count);
+        }
+
+        close(fd);
+        source->_text = source->_copy;
+        return source;
+    }
+}
@@ -0,0 +1,92 @@
+#include <codeanalysis/utils/StringTable.hpp>
+
+namespace trylang
+{
+    StringTable::~StringTable()
+    {
+        for(auto& entry: _entries)
+        {
+            if(--entry.second->_refCount == 0)
+            {
+                delete entry.second;
+            }
+        }
+    }
+
+    StringTable& StringTable::Instance()
+    {
+        static StringTable table;
+        return table;
+    }
+
+    Value StringTable::Intern(const Value& value)
+    {
+        if(value._tag != Value::Tag::String || value._string->_interned)
+        {
+            return value;
+        }
+
+        auto found = _entries.find(value.AsString());
+        if(found != _entries.end())
+        {
+            return Value::FromStringObject(found->second);
+        }
+
+        /* The object of value becomes the interned one, it is never modified in place since the table holds a reference */
+        auto* object = value._string;
+        object->_interned = true;
+        object->_refCount++;
+        _entries.emplace(object->_text, object);
+        return value;
+    }
+
+    Value StringTable::InternInput(std::string text)
+    {
+        if(!_internInput)
+        {
+            return Value(std::move(text));
+        }
+
+        if(_entries.size() >= _inputLimit)
+        {
+            /* A table full of live strings is not swept on every call, the scan would make input() linear in the table size */
+            if(_sweepDelay > 0)
+            {
+                _sweepDelay--;
+                return Value(std::move(text));
+            }
+
+            if(this->Sweep() < _inputLimit / 4)
+            {
+                _sweepDelay = _inputLimit / 4;
+            }
+
+            if(_entries.size() >= _inputLimit)
+            {
+                return Value(std::move(text));
+            }
+        }
+
+        return this->Intern(Value(std::move(text)));
+    }
+
+    std::size_t StringTable::Sweep()
+    {
+        std::size_t dropped = 0;
+        for(auto it = _entries.begin(); it != _entries.end();)
+        {
+            auto* object = it->second;
+            if(object->_refCount == 1)
+            {
+                it = _entries.erase(it);
+                delete object;
+                dropped++;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return dropped;
+    }
+}
@@ -14,7 +14,7 @@ namespace trylang
         return SymbolKind::Type;
     }
 
-    TypeSymbol* LookUpType(const std::string& name)
+    TypeSymbol* LookUpType(std::string_view name)
     {
         if(name == "int")
         {
@@ -45,17 +45,19 @@ namespace trylang
     }
 
     LabelSymbol::LabelSymbol(std::string name): _name(std::move(name))
-    {}
+    {
+        static int nextId = 0;
+        _id = nextId++;
+    }
 
     bool LabelSymbol::operator==(const LabelSymbol& other) const
     {
-        return _name == other._name;
+        return _id == other._id;
     }
 
     std::size_t LabelSymbolHash::operator()(const LabelSymbol& var) const
     {
-        // hash of name
-        return std::hash<std::string>{}(var._name);
+        return std::hash<int>{}(var._id);
     }
 
     std::size_t VariableSymbolHash::operator()(const VariableSymbol& var) const
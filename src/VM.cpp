@@ -0,0 +1,232 @@
+#include <codeanalysis/vm/VM.hpp>
+#include <codeanalysis/utils/StringTable.hpp>
+#include <codeanalysis/output/Output.hpp>
+#include <codeanalysis/input/Input.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+namespace trylang
+{
+    VM::VM(std::unique_ptr<CompiledProgram> program, std::size_t maxCallDepth)
+        : _program(std::move(program)), _maxCallDepth(maxCallDepth)
+    {
+        _globals.resize(_program->_globalCount);
+    }
+
+    Value VM::Run()
+    {
+        const auto& constants = _program->_constants;
+        const CompiledFunction* function = &_program->_functions[0];
+
+        _registers.resize(function->_registerCount);
+        _frames.push_back(CallFrame{function, nullptr, 0, 0});
+
+        Value* R = _registers.data();
+        const Instruction* ip = function->_code.data();
+
+        while(true)
+        {
+            const Instruction& instruction = *ip++;
+
+            switch(instruction._op)
+            {
+                case OpCode::LoadConstant:
+                    R[instruction._a] = constants[instruction._b];
+                    break;
+                case OpCode::Move:
+                    R[instruction._a] = R[instruction._b];
+                    break;
+                case OpCode::LoadGlobal:
+                    R[instruction._a] = _globals[instruction._b];
+                    break;
+                case OpCode::StoreGlobal:
+                    _globals[instruction._a] = R[instruction._b];
+                    break;
+                case OpCode::Clear:
+                    R[instruction._a] = Value();
+                    break;
+
+                case OpCode::AddInt:
+                    R[instruction._a] = R[instruction._b].AsInt() + R[instruction._c].AsInt();
+                    break;
+                case OpCode::SubtractInt:
+                    R[instruction._a] = R[instruction._b].AsInt() - R[instruction._c].AsInt();
+                    break;
+                case OpCode::MultiplyInt:
+                    R[instruction._a] = R[instruction._b].AsInt() * R[instruction._c].AsInt();
+                    break;
+                case OpCode::DivideInt:
+                    R[instruction._a] = R[instruction._b].AsInt() / R[instruction._c].AsInt();
+                    break;
+                case OpCode::Concat:
+                    R[instruction._a] = Value::Concatenate(R + instruction._b, instruction._c);
+                    break;
+                case OpCode::AppendString:
+                    R[instruction._a].Append(R[instruction._b]);
+                    break;
+                case OpCode::AppendGlobal:
+                    _globals[instruction._a].Append(R[instruction._b]);
+                    break;
+
+                case OpCode::EqualsInt:
+                    R[instruction._a] = R[instruction._b].AsInt() == R[instruction._c].AsInt();
+                    break;
+                case OpCode::NotEqualsInt:
+                    R[instruction._a] = R[instruction._b].AsInt() != R[instruction._c].AsInt();
+                    break;
+                case OpCode::EqualsBool:
+                    R[instruction._a] = R[instruction._b].AsBool() == R[instruction._c].AsBool();
+                    break;
+                case OpCode::NotEqualsBool:
+                    R[instruction._a] = R[instruction._b].AsBool() != R[instruction._c].AsBool();
+                    break;
+                case OpCode::EqualsString:
+                    R[instruction._a] = Value::StringEquals(R[instruction._b], R[instruction._c]);
+                    break;
+                case OpCode::NotEqualsString:
+                    R[instruction._a] = !Value::StringEquals(R[instruction._b], R[instruction._c]);
+                    break;
+                case OpCode::Less:
+                    R[instruction._a] = R[instruction._b].AsInt() < R[instruction._c].AsInt();
+                    break;
+                case OpCode::LessEquals:
+                    R[instruction._a] = R[instruction._b].AsInt() <= R[instruction._c].AsInt();
+                    break;
+                case OpCode::Greater:
+                    R[instruction._a] = R[instruction._b].AsInt() > R[instruction._c].AsInt();
+                    break;
+                case OpCode::GreaterEquals:
+                    R[instruction._a] = R[instruction._b].AsInt() >= R[instruction._c].AsInt();
+                    break;
+
+                case OpCode::Negate:
+                    R[instruction._a] = -R[instruction._b].AsInt();
+                    break;
+                case OpCode::LogicalNot:
+                    R[instruction._a] = !R[instruction._b].AsBool();
+                    break;
+
+                case OpCode::ToBool:
+                    R[instruction._a] = R[instruction._b].Visit(BoolConvertVisitor{});
+                    break;
+                case OpCode::ToInt:
+                    R[instruction._a] = R[instruction._b].Visit(IntConvertVisitor{});
+                    break;
+                case OpCode::ToString:
+                    R[instruction._a] = R[instruction._b].Visit(StringConvertVisitor{});
+                    break;
+
+                case OpCode::Jump:
+                    ip = function->_code.data() + instruction._a;
+                    break;
+                case OpCode::JumpIfFalse:
+                    if(!R[instruction._a].AsBool())
+                    {
+                        ip = function->_code.data() + instruction._b;
+                    }
+                    break;
+                case OpCode::JumpIfTrue:
+                    if(R[instruction._a].AsBool())
+                    {
+                        ip = function->_code.data() + instruction._b;
+                    }
+                    break;
+
+                case OpCode::Call:
+                {
+                    /* _frames[0] is the top level program, every other frame is an active call */
+                    if(_frames.size() > _maxCallDepth)
+                    {
+                        throw std::runtime_error("Stack overflow: more than " + std::to_string(_maxCallDepth) + " nested calls (see --max-call-depth)");
+                    }
+
+                    const CompiledFunction* callee = &_program->_functions[instruction._b];
+                    auto base = _frames.back()._base + instruction._c;
+
+                    if(_registers.size() < base + callee->_registerCount)
+                    {
+                        _registers.resize(base + callee->_registerCount);
+                    }
+
+                    _frames.push_back(CallFrame{callee, ip, base, instruction._a});
+
+                    function = callee;
+                    R = _registers.data() + base;
+                    ip = function->_code.data();
+                    break;
+                }
+                case OpCode::TailCall:
+                {
+                    /* The arguments are moved down to R[0]. Copying upwards reads R[c + i] before any write can reach it */
+                    const CompiledFunction* callee = &_program->_functions[instruction._b];
+                    for(auto i = 0; i < callee->_arity; i++)
+                    {
+                        R[i] = std::move(R[instruction._c + i]);
+                    }
+
+                    auto& frame = _frames.back();
+                    if(_registers.size() < frame._base + callee->_registerCount)
+                    {
+                        _registers.resize(frame._base + callee->_registerCount);
+                        R = _registers.data() + frame._base;
+                    }
+
+                    frame._function = callee;
+                    function = callee;
+                    ip = function->_code.data();
+                    break;
+                }
+                case OpCode::Print:
+                {
+                    const auto& message = R[instruction._b].AsString();
+                    Output::Instance().WriteLine(message);
+                    R[instruction._a] = static_cast<int>(message.size());
+                    break;
+                }
+                case OpCode::PrintParts:
+                {
+                    auto& output = Output::Instance();
+                    std::size_t length = 0;
+                    for(auto i = 0; i < instruction._c; i++)
+                    {
+                        length += output.WriteValue(R[instruction._b + i]);
+                    }
+                    output.EndLine();
+                    R[instruction._a] = static_cast<int>(length);
+                    break;
+                }
+                case OpCode::Input:
+                    R[instruction._a] = StringTable::Instance().InternInput(std::string(Input::Instance().NextLine()));
+                    break;
+                case OpCode::Lines:
+                    R[instruction._a] = Input::Instance().HasLine();
+                    break;
+                case OpCode::CallNative:
+                    R[instruction._a] = _program->_natives[instruction._b](R + instruction._c);
+                    break;
+                case OpCode::Return:
+                {
+                    Value result = instruction._a == -1 ? Value{0} : std::move(R[instruction._a]);
+                    CallFrame finished = _frames.back();
+                    _frames.pop_back();
+
+                    if(_frames.empty())
+                    {
+                        return result;
+                    }
+
+                    const CallFrame& caller = _frames.back();
+                    function = caller._function;
+                    R = _registers.data() + caller._base;
+                    ip = finished._returnAddress;
+                    R[finished._returnRegister] = std::move(result);
+                    break;
+                }
+                default:
+                    throw std::logic_error("VM: Unexpected instruction");
+            }
+        }
+    }
+}